@@ -0,0 +1,103 @@
+#include "screen.h"
+
+#ifndef UNIT
+
+void SpiTransport::Begin() {
+    /* this calls the peripheral hardware interface, see epdif */
+    pinMode(CS_PIN, OUTPUT);
+    pinMode(RST_PIN, OUTPUT);
+    pinMode(DC_PIN, OUTPUT);
+    pinMode(BUSY_PIN, INPUT);
+
+    SPI.begin();
+    SPI.beginTransaction(SPISettings(2000000, MSBFIRST, SPI_MODE0));
+}
+
+/**
+ *  @brief: module reset.
+ *          often used to awaken the module in deep sleep
+ */
+void SpiTransport::Reset() {
+    digitalWrite(RST_PIN, HIGH);
+    delay(200);
+    digitalWrite(RST_PIN, LOW); //module reset
+    delay(10);
+    digitalWrite(RST_PIN, HIGH);
+    delay(200);
+}
+
+void SpiTransport::PowerDown() {
+    digitalWrite(RST_PIN, LOW);
+}
+
+/* DC only changes between commands and their data, skip redundant pin writes */
+void SpiTransport::SetDC(int level) {
+    if(dc != level) {
+        digitalWrite(DC_PIN, level);
+        dc = level;
+    }
+}
+
+void SpiTransport::Transfer(uint8_t data) {
+#ifdef EPD_TRANSFER_TIMING
+    unsigned long start = micros();
+#endif
+    digitalWrite(CS_PIN, LOW);
+    SPI.transfer(data);
+    digitalWrite(CS_PIN, HIGH);
+    transfer.bytes++;
+    transfer.transfers++;
+#ifdef EPD_TRANSFER_TIMING
+    transfer.micros += micros() - start;
+#endif
+}
+
+/**
+ *  @brief: basic function for sending commands
+ */
+void SpiTransport::Command(uint8_t command) {
+    SetDC(LOW);
+    Transfer(command);
+}
+
+/**
+ *  @brief: basic function for sending data
+ */
+void SpiTransport::Data(uint8_t data) {
+    SetDC(HIGH);
+    Transfer(data);
+}
+
+/**
+ *  @brief: send a run of data bytes with DC set once and CS held low throughout
+ */
+void SpiTransport::DataBlock(const uint8_t *data, size_t len) {
+#ifdef EPD_TRANSFER_TIMING
+    unsigned long start = micros();
+#endif
+    SetDC(HIGH);
+    digitalWrite(CS_PIN, LOW);
+    for(size_t i = 0; i < len; i++)
+        SPI.transfer(data[i]);
+    digitalWrite(CS_PIN, HIGH);
+    transfer.bytes += len;
+    transfer.transfers++;
+#ifdef EPD_TRANSFER_TIMING
+    transfer.micros += micros() - start;
+#endif
+}
+
+/* LOW: idle, HIGH: busy */
+bool SpiTransport::Busy() {
+    return digitalRead(BUSY_PIN) == HIGH;
+}
+
+void SpiTransport::Delay(unsigned long ms) {
+    delay(ms);
+}
+
+unsigned long SpiTransport::Millis() {
+    return millis();
+}
+
+#endif
@@ -0,0 +1,59 @@
+#ifndef EPD_TRANSPORT_H
+#define EPD_TRANSPORT_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/* traffic counters kept by every transport */
+struct EpdTransferStats {
+    unsigned long bytes;     // command and data bytes sent
+    unsigned long transfers; // chip-select assertions
+    unsigned long micros;    // time spent on the bus (SpiTransport: only with EPD_TRANSFER_TIMING defined)
+};
+
+/*
+The link between Screen and an SSD1675 style controller: command/data bytes,
+the reset and busy lines, and a clock. SpiTransport drives the real panel;
+EpdSim (epdsim.h) decodes the same stream on a host build.
+*/
+class EpdTransport {
+    public:
+        virtual ~EpdTransport() { }
+        virtual void Begin() = 0;                   // set up pins and the bus
+        virtual void Reset() = 0;                   // pulse the reset line
+        virtual void PowerDown() = 0;               // hold the module in reset after deep sleep
+        virtual void Command(uint8_t command) = 0;
+        virtual void Data(uint8_t data) = 0;
+        /* send len data bytes in one chip-select; the default sends them one at a time */
+        virtual void DataBlock(const uint8_t *data, size_t len) {
+            for(size_t i = 0; i < len; i++)
+                Data(data[i]);
+        }
+        virtual bool Busy() = 0;
+        virtual void Delay(unsigned long ms) = 0;
+        virtual unsigned long Millis() = 0;
+        EpdTransferStats transfer = { 0, 0, 0 };
+};
+
+#ifndef UNIT
+/* the panel wired to the hardware SPI bus and the *_PIN lines from screen.h */
+class SpiTransport : public EpdTransport {
+    public:
+        void Begin();
+        void Reset();
+        void PowerDown();
+        void Command(uint8_t command);
+        void Data(uint8_t data);
+        void DataBlock(const uint8_t *data, size_t len);
+        bool Busy();
+        void Delay(unsigned long ms);
+        unsigned long Millis();
+
+    private:
+        int dc = -1; // last level written to DC_PIN
+        void SetDC(int level);
+        void Transfer(uint8_t data);
+};
+#endif
+
+#endif
@@ -0,0 +1,272 @@
+#include "epdsim.h"
+
+#ifdef UNIT
+#include <stdio.h>
+#include <string.h>
+
+EpdSim::EpdSim() {
+    memset(ram, 0xFF, sizeof(ram));
+    memset(shown, 0xFF, sizeof(shown));
+    memset(ghost, 0, sizeof(ghost));
+    now = 0;
+    busyUntil = 0;
+    busUs = 0;
+    PowerOn();
+    ResetStats();
+}
+
+/* registers at their power-on defaults: no waveform, X and Y counting up over the whole RAM */
+void EpdSim::PowerOn() {
+    memset(lut, 0, sizeof(lut));
+    cmd = 0;
+    argc = 0;
+    entryMode = 0x03;
+    updateMode = 0;
+    pingPong = false;
+    asleep = false;
+    xStart = 0;
+    xEnd = SIM_ROWBYTES - 1;
+    yStart = 0;
+    yEnd = SIM_ROWS - 1;
+    xAddr = 0;
+    yAddr = 0;
+}
+
+void EpdSim::ResetStats() {
+    memset(&stats, 0, sizeof(stats));
+    memset(&transfer, 0, sizeof(transfer));
+    stats.rowFirst = -1;
+    stats.rowLast = -1;
+}
+
+void EpdSim::Begin() { }
+
+/* a hardware reset wakes the controller with its power-on registers; RAM keeps its contents */
+void EpdSim::Reset() {
+    now += 410;
+    busyUntil = now;
+    PowerOn();
+}
+
+void EpdSim::PowerDown() { }
+
+bool EpdSim::Busy() {
+    return now < busyUntil;
+}
+
+void EpdSim::Delay(unsigned long ms) {
+    now += ms;
+}
+
+unsigned long EpdSim::Millis() {
+    return now;
+}
+
+/* account for time on the bus, advancing the clock a whole ms at a time */
+void EpdSim::Bus(unsigned long us) {
+    transfer.micros += us;
+    busUs += us;
+    now += busUs / 1000;
+    busUs %= 1000;
+}
+
+/* single byte: CS low, DC, byte, CS high */
+void EpdSim::Command(uint8_t command) {
+    transfer.bytes++;
+    transfer.transfers++;
+    Bus(3 * SIM_PIN_US + SIM_BYTE_US);
+    if(asleep)
+        return;
+    cmd = command;
+    argc = 0;
+    stats.commands++;
+    switch(command) {
+        case 0x12: // soft reset
+            busyUntil = now + SIM_RESET_MS;
+            break;
+        case 0x20:
+            Activate();
+            break;
+    }
+}
+
+void EpdSim::Data(uint8_t data) {
+    transfer.bytes++;
+    transfer.transfers++;
+    Bus(3 * SIM_PIN_US + SIM_BYTE_US);
+    Receive(data);
+}
+
+/* block: DC and the two CS edges once, then the bytes back to back */
+void EpdSim::DataBlock(const uint8_t *data, size_t len) {
+    transfer.bytes += len;
+    transfer.transfers++;
+    Bus(3 * SIM_PIN_US + len * SIM_BYTE_US);
+    for(size_t i = 0; i < len; i++)
+        Receive(data[i]);
+}
+
+void EpdSim::Receive(uint8_t data) {
+    if(asleep)
+        return;
+    stats.dataBytes++;
+    stats.perCommand[cmd]++;
+    if(cmd == 0x24 || cmd == 0x26) {
+        WriteRam(cmd == 0x24 ? 0 : 1, data);
+        return;
+    }
+    if(argc < (int)sizeof(args))
+        args[argc] = data;
+    argc++;
+    Arg(data);
+}
+
+/* apply the argument just received for the current command */
+void EpdSim::Arg(uint8_t data) {
+    switch(cmd) {
+        case 0x10: // deep sleep
+            asleep = data != 0;
+            break;
+        case 0x11:
+            entryMode = data;
+            break;
+        case 0x22:
+            updateMode = data;
+            break;
+        case 0x32:
+            if(argc <= (int)sizeof(lut))
+                lut[argc - 1] = data;
+            break;
+        case 0x37:
+            if(argc == 5)
+                pingPong = (data & 0x40) != 0;
+            break;
+        case 0x44:
+            if(argc == 1)
+                xStart = data & 0x1F;
+            else if(argc == 2)
+                xEnd = data & 0x1F;
+            break;
+        case 0x45:
+            if(argc == 2)
+                yStart = args[0] | ((args[1] & 1) << 8);
+            else if(argc == 4)
+                yEnd = args[2] | ((args[3] & 1) << 8);
+            break;
+        case 0x4E:
+            xAddr = data & 0x1F;
+            break;
+        case 0x4F:
+            if(argc == 1)
+                yAddr = data;
+            else if(argc == 2)
+                yAddr = args[0] | ((args[1] & 1) << 8);
+            break;
+    }
+}
+
+/* store a byte at the address counter and advance it within the window (X first) */
+void EpdSim::WriteRam(int ramIndex, uint8_t data) {
+    if(xAddr < SIM_ROWBYTES && yAddr < SIM_ROWS) {
+        ram[ramIndex][yAddr][xAddr] = data;
+        int row = SIM_ROWS - 1 - yAddr;
+        if(stats.rowFirst < 0 || row < stats.rowFirst)
+            stats.rowFirst = row;
+        if(row > stats.rowLast)
+            stats.rowLast = row;
+    }
+    stats.ramBytes++;
+
+    bool xInc = entryMode & 0x01, yInc = entryMode & 0x02;
+    int xLo = xStart < xEnd ? xStart : xEnd, xHi = xStart < xEnd ? xEnd : xStart;
+    int yLo = yStart < yEnd ? yStart : yEnd, yHi = yStart < yEnd ? yEnd : yStart;
+    xAddr += xInc ? 1 : -1;
+    if(xAddr < xLo || xAddr > xHi) {
+        xAddr = xInc ? xLo : xHi;
+        yAddr += yInc ? 1 : -1;
+        if(yAddr < yLo || yAddr > yHi)
+            yAddr = yInc ? yLo : yHi;
+    }
+}
+
+/*
+master activation: run the sequence selected with 0x22. Display mode 2 picks each pixel's waveform
+by its previous (0x26) and new (0x24) value; with a LUT that leaves unchanged pixels alone (LUT0 BB
+and LUT3 WW empty) only the pixels that differ are driven, so a stale 0x26 shows up as pixels left
+as they were; each row it changes gains a ghost until a full drive clears them. Ping-pong copies
+0x24 into 0x26 after a mode 2 refresh only.
+*/
+void EpdSim::Activate() {
+    unsigned long ms = SIM_POWER_MS;
+    if(updateMode & 0x04) { // display
+        bool mode2 = (updateMode & 0x08) != 0, keep = true;
+        for(int i = 0; i < 7; i++)
+            keep = keep && lut[i] == 0 && lut[21 + i] == 0;
+        // TP A..D of the 7 phases after the 35 voltage bytes, each phase run RP + 1 times
+        int frames = 0;
+        for(int phase = 0; phase < 7; phase++) {
+            const uint8_t *tp = lut + 35 + phase * 5;
+            frames += (tp[0] + tp[1] + tp[2] + tp[3]) * (tp[4] + 1);
+        }
+        ms = frames * SIM_FRAME_MS;
+        stats.lastFrames = frames;
+        if(frames == 0) {
+            // no waveform loaded, nothing is driven
+        } else if(mode2 && keep) {
+            stats.partialRefreshes++;
+            for(int y = 0; y < SIM_ROWS; y++) {
+                uint8_t changed = 0;
+                for(int x = 0; x < SIM_ROWBYTES; x++) {
+                    uint8_t drive = ram[0][y][x] ^ ram[1][y][x];
+                    changed |= drive & (shown[y][x] ^ ram[0][y][x]);
+                    shown[y][x] = (shown[y][x] & ~drive) | (ram[0][y][x] & drive);
+                }
+                if(changed && ++ghost[y] > stats.ghostMax)
+                    stats.ghostMax = ghost[y];
+            }
+        } else {
+            memcpy(shown, ram[0], sizeof(shown));
+            memset(ghost, 0, sizeof(ghost));
+            stats.fullRefreshes++;
+        }
+        if(pingPong && mode2)
+            memcpy(ram[1], ram[0], sizeof(shown));
+        stats.refreshMs += ms;
+    }
+    busyUntil = now + ms;
+}
+
+/* RAM rows are stored bottom up */
+bool EpdSim::RamsMatch(int first, int last) {
+    for(int y = first; y <= last; y++)
+        if(memcmp(ram[0][SIM_ROWS - 1 - y], ram[1][SIM_ROWS - 1 - y], SIM_ROWBYTES) != 0)
+            return false;
+    return true;
+}
+
+/* RAM rows are stored bottom up and RAM x runs right to left as the panel is read */
+bool EpdSim::Pixel(int x, int y) {
+    int rx = 121 - x, ry = SIM_ROWS - 1 - y;
+    return !((shown[ry][rx / 8] >> (7 - rx % 8)) & 1);
+}
+
+int EpdSim::WritePBM(const char *path) {
+    FILE *f = fopen(path, "wb");
+    if(f == nullptr)
+        return 1;
+    fprintf(f, "P4\n122 %d\n", SIM_ROWS);
+    for(int y = 0; y < SIM_ROWS; y++) {
+        for(int xb = 0; xb < SIM_ROWBYTES; xb++) {
+            uint8_t byte = 0;
+            for(int b = 0; b < 8; b++) {
+                int x = xb * 8 + b;
+                if(x < 122 && Pixel(x, y))
+                    byte |= 0x80 >> b;
+            }
+            fputc(byte, f);
+        }
+    }
+    fclose(f);
+    return 0;
+}
+#endif
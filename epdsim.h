@@ -0,0 +1,86 @@
+#ifndef EPDSIM_H
+#define EPDSIM_H
+
+/*
+Host-side stand-in for the panel (UNIT builds). Decodes the controller command
+stream Screen sends - RAM windows (0x44/0x45), address counters (0x4E/0x4F),
+data entry mode (0x11), RAM writes (0x24/0x26) and refreshes (0x22/0x20) - into
+the two 250 row RAMs and the image the panel would show, and keeps a virtual
+clock so refreshes take as long as they would on the real module.
+*/
+
+#ifdef UNIT
+#include "epd_transport.h"
+
+#define SIM_ROWS 250
+#define SIM_ROWBYTES 16
+
+/* modelled durations in ms: a refresh takes one frame per step of the loaded waveform LUT (0x32) */
+#define SIM_FRAME_MS 22
+#define SIM_POWER_MS 100
+#define SIM_RESET_MS 10
+
+/* modelled bus costs in us: one byte at 2 MHz SPI, one digitalWrite on a 16 MHz AVR */
+#define SIM_BYTE_US 4
+#define SIM_PIN_US 4
+
+struct EpdSimStats {
+    long commands;
+    long dataBytes;
+    long ramBytes;          // bytes written to RAM 0x24 or 0x26
+    int rowFirst;           // span of image rows written since the stats were reset, -1 when none
+    int rowLast;
+    int fullRefreshes;
+    int partialRefreshes;
+    unsigned long refreshMs; // time the panel spent busy refreshing
+    int lastFrames;         // waveform frames the last refresh ran
+    int ghostMax;           // most partial refreshes that changed a row since it was last driven whole
+    long perCommand[256];   // data bytes following each command
+};
+
+class EpdSim : public EpdTransport {
+    public:
+        EpdSim();
+        void Begin();
+        void Reset();
+        void PowerDown();
+        void Command(uint8_t command);
+        void Data(uint8_t data);
+        void DataBlock(const uint8_t *data, size_t len);
+        bool Busy();
+        void Delay(unsigned long ms);
+        unsigned long Millis();
+
+        /* the displayed image the way the text reads: x 0..121, y 0..249, true = black */
+        bool Pixel(int x, int y);
+        int WritePBM(const char *path);
+        /* true if RAM 0x26 holds the same as 0x24 over panel rows first..last */
+        bool RamsMatch(int first, int last);
+        void ResetStats();
+        EpdSimStats stats;
+
+    private:
+        uint8_t ram[2][SIM_ROWS][SIM_ROWBYTES]; // 0x24 (new) and 0x26 (previous) image, 1 = white
+        uint8_t shown[SIM_ROWS][SIM_ROWBYTES];
+        uint8_t lut[70];        // last waveform written with 0x32
+        uint16_t ghost[SIM_ROWS]; // partial refreshes that changed each row since a full drive
+        uint8_t cmd;
+        uint8_t args[8];
+        int argc;
+        uint8_t entryMode;
+        uint8_t updateMode;     // last 0x22 display option
+        bool pingPong;          // 0x37 display mode 2 option, copy 0x24 into 0x26 after a mode 2 refresh
+        bool asleep;
+        int xStart, xEnd, yStart, yEnd, xAddr, yAddr;
+        unsigned long now, busyUntil;
+        unsigned long busUs;    // bus time not yet added to now
+        void Bus(unsigned long us);
+        void Receive(uint8_t data);
+        void Arg(uint8_t data);
+        void WriteRam(int ramIndex, uint8_t data);
+        void PowerOn();
+        void Activate();
+};
+#endif
+
+#endif
@@ -1,70 +1,37 @@
 #include <SPI.h>
 #include "screen.h"
+#include "screen_link.h"
 #include "fonts.h"
 #include <stdio.h>
 
+// Driven from a computer with tools/screenlink.py, e.g.
+//   tools/screenlink.py --port /dev/ttyACM0 "print 0 'Hello' center" "print 4 '21.5C' right" draw
+//   tools/screenlink.py "image 5 picture.pbm" draw
 Screen s;
-
-int buff[64];
-int rPtr = 0;
-int wPtr = 0;
+ScreenLink screenLink(&s);
 
 void setup()
 {
     // put your setup code here, to run once:
-    Serial.begin(9600);
+    Serial.begin(115200);
 
-    s.ScreenInit(5);
+    s.ScreenInit(6);
     s.DefineSection(0, 2, &Font8);
     s.DefineSection(1, 2, &Font12);
     s.DefineSection(2, 2, &Font16);
     s.DefineSection(3, 2, &Font20);
     s.DefineSection(4, 2, &Font24);
+    s.DefineImage(5, 90);
 }
 
 void loop()
 {
+  uint8_t reply[LINK_REPLY_BYTES];
   while(Serial.available() > 0) {
-    buff[wPtr] = Serial.read();
-    if(buff[wPtr] == (int)';' || buff[wPtr] == (int)'\n') {
-      char build[64];
-      int i;
-      for(i = 0; i < 64; i++) {
-        build[i] = '\0';
-      }
-      i = 0;
-      while(wPtr != rPtr) {
-        build[i] = (char)buff[rPtr];
-        rPtr++;
-        if(rPtr == 64) {
-          rPtr = 0;
-        }
-        i++;
-      }
-      if(strcmp(build, "clear") == 0) {
-        s.Clear();
-      } else if(strcmp(build, "die") == 0) {
-        s.Sleep();
-      } else if(strcmp(build, "wake") == 0) {
-        s.Reset();
-      } else {
-        for(int i = 0; i < 64; i++) {
-          if(build[i] == '\0')
-            break;
-          else if(build[i] == '\\')
-            build[i] = '\n';
-        }
-        for(int i = 0; i < 5; i++) {
-          s.Print(i, build, ALIGN_CENTER);
-        }
-        s.Draw();
-      }
-      Serial.println("Message Received ");
-      rPtr++; // get past the trailing semicolon
-    }
-    wPtr++;
-    if(wPtr == 64) {
-      wPtr = 0;
-    }
+    size_t n = screenLink.Receive(Serial.read(), reply);
+    if(n > 0)
+      Serial.write(reply, n);
   }
+  // refreshes run in the background, frames arriving meanwhile go on the next one
+  screenLink.Poll();
 }
@@ -0,0 +1,229 @@
+/* Proportional Font12V generated by tools/fontprop.py from font12.c, do not edit.
+   12 rows, advances 2..8 pixels. */
+
+#include "fonts.h"
+
+const uint8_t Font12V_Table[] PROGMEM = 
+{
+	// @0 ' ' (4 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @6 '!' (2 pixels wide)
+	0x2A, 0xA0, 0x80,
+	// @9 '"' (6 pixels wide)
+	0x03, 0x69, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @18 '#' (6 pixels wide)
+	0x00, 0xA2, 0x94, 0xF9, 0x4F, 0x94, 0xA2, 0x80, 0x00,
+	// @27 '$' (5 pixels wide)
+	0x01, 0x1D, 0x08, 0x3A, 0x5C, 0x21, 0x00, 0x00,
+	// @35 '%' (6 pixels wide)
+	0x01, 0x0A, 0x10, 0x1B, 0x81, 0x0A, 0x10, 0x00, 0x00,
+	// @44 '&' (6 pixels wide)
+	0x00, 0x00, 0x0C, 0x41, 0x0A, 0xA4, 0x68, 0x00, 0x00,
+	// @53 ''' (2 pixels wide)
+	0x2A, 0x80, 0x00,
+	// @56 '(' (3 pixels wide)
+	0x09, 0x49, 0x24, 0x89, 0x00,
+	// @61 ')' (3 pixels wide)
+	0x12, 0x24, 0x92, 0x52, 0x00,
+	// @66 '*' (6 pixels wide)
+	0x00, 0x8F, 0x88, 0x51, 0x40, 0x00, 0x00, 0x00, 0x00,
+	// @75 '+' (8 pixels wide)
+	0x00, 0x00, 0x10, 0x10, 0x10, 0xFE, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00,
+	// @87 ',' (4 pixels wide)
+	0x00, 0x00, 0x00, 0x06, 0x4C, 0x80,
+	// @93 '-' (6 pixels wide)
+	0x00, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00,
+	// @102 '.' (3 pixels wide)
+	0x00, 0x00, 0x06, 0xC0, 0x00,
+	// @107 '/' (6 pixels wide)
+	0x00, 0x20, 0x84, 0x10, 0x82, 0x10, 0x42, 0x00, 0x00,
+	// @116 '0' (6 pixels wide)
+	0x01, 0xC8, 0xA2, 0x8A, 0x28, 0xA2, 0x70, 0x00, 0x00,
+	// @125 '1' (6 pixels wide)
+	0x01, 0x82, 0x08, 0x20, 0x82, 0x08, 0xF8, 0x00, 0x00,
+	// @134 '2' (6 pixels wide)
+	0x01, 0xC8, 0x82, 0x10, 0x84, 0x22, 0xF8, 0x00, 0x00,
+	// @143 '3' (6 pixels wide)
+	0x01, 0xC8, 0x82, 0x30, 0x20, 0xA2, 0x70, 0x00, 0x00,
+	// @152 '4' (7 pixels wide)
+	0x00, 0x30, 0xA1, 0x44, 0x91, 0x3F, 0x04, 0x1C, 0x00, 0x00, 0x00,
+	// @163 '5' (6 pixels wide)
+	0x01, 0xE4, 0x10, 0x70, 0x20, 0xA2, 0x70, 0x00, 0x00,
+	// @172 '6' (6 pixels wide)
+	0x00, 0xE4, 0x20, 0xF2, 0x28, 0xA2, 0x70, 0x00, 0x00,
+	// @181 '7' (6 pixels wide)
+	0x03, 0xE8, 0x82, 0x10, 0x41, 0x08, 0x20, 0x00, 0x00,
+	// @190 '8' (6 pixels wide)
+	0x01, 0xC8, 0xA2, 0x72, 0x28, 0xA2, 0x70, 0x00, 0x00,
+	// @199 '9' (6 pixels wide)
+	0x01, 0xC8, 0xA2, 0x89, 0xE0, 0x84, 0xE0, 0x00, 0x00,
+	// @208 ':' (3 pixels wide)
+	0x00, 0x6C, 0x06, 0xC0, 0x00,
+	// @213 ';' (4 pixels wide)
+	0x00, 0x06, 0x60, 0x06, 0xC8, 0x00,
+	// @219 '<' (7 pixels wide)
+	0x00, 0x00, 0x30, 0x86, 0x10, 0x18, 0x08, 0x0C, 0x00, 0x00, 0x00,
+	// @230 '=' (6 pixels wide)
+	0x00, 0x00, 0x00, 0xF8, 0x0F, 0x80, 0x00, 0x00, 0x00,
+	// @239 '>' (7 pixels wide)
+	0x00, 0x03, 0x01, 0x01, 0x80, 0x86, 0x10, 0xC0, 0x00, 0x00, 0x00,
+	// @250 '?' (5 pixels wide)
+	0x00, 0x19, 0x21, 0x11, 0x00, 0xC0, 0x00, 0x00,
+	// @258 '@' (6 pixels wide)
+	0x72, 0x28, 0xA6, 0xAA, 0xA9, 0xA0, 0x89, 0xC0, 0x00,
+	// @267 'A' (8 pixels wide)
+	0x00, 0x30, 0x10, 0x28, 0x28, 0x28, 0x7C, 0x44, 0xEE, 0x00, 0x00, 0x00,
+	// @279 'B' (7 pixels wide)
+	0x01, 0xF1, 0x12, 0x27, 0x88, 0x91, 0x22, 0xF8, 0x00, 0x00, 0x00,
+	// @290 'C' (6 pixels wide)
+	0x01, 0xE8, 0xA0, 0x82, 0x08, 0x22, 0x70, 0x00, 0x00,
+	// @299 'D' (7 pixels wide)
+	0x01, 0xE1, 0x22, 0x24, 0x48, 0x91, 0x24, 0xF0, 0x00, 0x00, 0x00,
+	// @310 'E' (7 pixels wide)
+	0x01, 0xF9, 0x12, 0x87, 0x0A, 0x10, 0x22, 0xFC, 0x00, 0x00, 0x00,
+	// @321 'F' (7 pixels wide)
+	0x01, 0xF9, 0x12, 0x87, 0x0A, 0x10, 0x20, 0xE0, 0x00, 0x00, 0x00,
+	// @332 'G' (7 pixels wide)
+	0x00, 0xF2, 0x24, 0x08, 0x13, 0xA2, 0x44, 0x70, 0x00, 0x00, 0x00,
+	// @343 'H' (8 pixels wide)
+	0x00, 0xEE, 0x44, 0x44, 0x7C, 0x44, 0x44, 0x44, 0xEE, 0x00, 0x00, 0x00,
+	// @355 'I' (6 pixels wide)
+	0x03, 0xE2, 0x08, 0x20, 0x82, 0x08, 0xF8, 0x00, 0x00,
+	// @364 'J' (6 pixels wide)
+	0x01, 0xE1, 0x04, 0x12, 0x49, 0x24, 0x60, 0x00, 0x00,
+	// @373 'K' (8 pixels wide)
+	0x00, 0xEE, 0x44, 0x48, 0x50, 0x70, 0x48, 0x44, 0xE6, 0x00, 0x00, 0x00,
+	// @385 'L' (6 pixels wide)
+	0x03, 0x84, 0x10, 0x41, 0x04, 0x92, 0xF8, 0x00, 0x00,
+	// @394 'M' (8 pixels wide)
+	0x00, 0xEE, 0x6C, 0x6C, 0x54, 0x54, 0x44, 0x44, 0xEE, 0x00, 0x00, 0x00,
+	// @406 'N' (8 pixels wide)
+	0x00, 0xEE, 0x64, 0x64, 0x54, 0x54, 0x54, 0x4C, 0xEC, 0x00, 0x00, 0x00,
+	// @418 'O' (6 pixels wide)
+	0x01, 0xC8, 0xA2, 0x8A, 0x28, 0xA2, 0x70, 0x00, 0x00,
+	// @427 'P' (6 pixels wide)
+	0x03, 0xC4, 0x92, 0x49, 0xC4, 0x10, 0xE0, 0x00, 0x00,
+	// @436 'Q' (6 pixels wide)
+	0x01, 0xC8, 0xA2, 0x8A, 0x28, 0xA2, 0x70, 0xE0, 0x00,
+	// @445 'R' (8 pixels wide)
+	0x00, 0xF8, 0x44, 0x44, 0x44, 0x78, 0x48, 0x44, 0xE2, 0x00, 0x00, 0x00,
+	// @457 'S' (6 pixels wide)
+	0x01, 0xA9, 0xA0, 0x70, 0x20, 0xB2, 0xB0, 0x00, 0x00,
+	// @466 'T' (8 pixels wide)
+	0x00, 0xFE, 0x92, 0x10, 0x10, 0x10, 0x10, 0x10, 0x38, 0x00, 0x00, 0x00,
+	// @478 'U' (8 pixels wide)
+	0x00, 0xEE, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x38, 0x00, 0x00, 0x00,
+	// @490 'V' (8 pixels wide)
+	0x00, 0xEE, 0x44, 0x44, 0x28, 0x28, 0x28, 0x10, 0x10, 0x00, 0x00, 0x00,
+	// @502 'W' (8 pixels wide)
+	0x00, 0xEE, 0x44, 0x44, 0x54, 0x54, 0x54, 0x54, 0x28, 0x00, 0x00, 0x00,
+	// @514 'X' (8 pixels wide)
+	0x00, 0xC6, 0x44, 0x28, 0x10, 0x10, 0x28, 0x44, 0xC6, 0x00, 0x00, 0x00,
+	// @526 'Y' (8 pixels wide)
+	0x00, 0xEE, 0x44, 0x28, 0x28, 0x10, 0x10, 0x10, 0x38, 0x00, 0x00, 0x00,
+	// @538 'Z' (6 pixels wide)
+	0x03, 0xE8, 0x84, 0x20, 0x84, 0x22, 0xF8, 0x00, 0x00,
+	// @547 '[' (4 pixels wide)
+	0x0E, 0x88, 0x88, 0x88, 0x88, 0xE0,
+	// @553 '\' (5 pixels wide)
+	0x04, 0x10, 0x84, 0x10, 0x82, 0x10, 0x80, 0x00,
+	// @561 ']' (4 pixels wide)
+	0x0E, 0x22, 0x22, 0x22, 0x22, 0xE0,
+	// @567 '^' (6 pixels wide)
+	0x00, 0x82, 0x14, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @576 '_' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,
+	// @588 '`' (3 pixels wide)
+	0x11, 0x00, 0x00, 0x00, 0x00,
+	// @593 'a' (7 pixels wide)
+	0x00, 0x00, 0x03, 0x88, 0x8F, 0x22, 0x44, 0x7C, 0x00, 0x00, 0x00,
+	// @604 'b' (7 pixels wide)
+	0x01, 0x81, 0x02, 0xC6, 0x48, 0x91, 0x22, 0xF8, 0x00, 0x00, 0x00,
+	// @615 'c' (6 pixels wide)
+	0x00, 0x00, 0x1E, 0x8A, 0x08, 0x22, 0x70, 0x00, 0x00,
+	// @624 'd' (7 pixels wide)
+	0x00, 0x30, 0x23, 0x49, 0x91, 0x22, 0x44, 0x7C, 0x00, 0x00, 0x00,
+	// @635 'e' (6 pixels wide)
+	0x00, 0x00, 0x1C, 0x8B, 0xE8, 0x20, 0x78, 0x00, 0x00,
+	// @644 'f' (6 pixels wide)
+	0x00, 0xE4, 0x3E, 0x41, 0x04, 0x10, 0xF8, 0x00, 0x00,
+	// @653 'g' (7 pixels wide)
+	0x00, 0x00, 0x03, 0x69, 0x91, 0x22, 0x44, 0x78, 0x11, 0xC0, 0x00,
+	// @664 'h' (8 pixels wide)
+	0x00, 0xC0, 0x40, 0x58, 0x64, 0x44, 0x44, 0x44, 0xEE, 0x00, 0x00, 0x00,
+	// @676 'i' (6 pixels wide)
+	0x00, 0x80, 0x38, 0x20, 0x82, 0x08, 0xF8, 0x00, 0x00,
+	// @685 'j' (5 pixels wide)
+	0x01, 0x01, 0xE1, 0x08, 0x42, 0x10, 0xB8, 0x00,
+	// @693 'k' (7 pixels wide)
+	0x01, 0x81, 0x02, 0xE4, 0x8E, 0x14, 0x24, 0xDC, 0x00, 0x00, 0x00,
+	// @704 'l' (6 pixels wide)
+	0x01, 0x82, 0x08, 0x20, 0x82, 0x08, 0xF8, 0x00, 0x00,
+	// @713 'm' (8 pixels wide)
+	0x00, 0x00, 0x00, 0xE8, 0x54, 0x54, 0x54, 0x54, 0xFE, 0x00, 0x00, 0x00,
+	// @725 'n' (8 pixels wide)
+	0x00, 0x00, 0x00, 0xD8, 0x64, 0x44, 0x44, 0x44, 0xEE, 0x00, 0x00, 0x00,
+	// @737 'o' (6 pixels wide)
+	0x00, 0x00, 0x1C, 0x8A, 0x28, 0xA2, 0x70, 0x00, 0x00,
+	// @746 'p' (7 pixels wide)
+	0x00, 0x00, 0x06, 0xC6, 0x48, 0x91, 0x22, 0x78, 0x83, 0x80, 0x00,
+	// @757 'q' (7 pixels wide)
+	0x00, 0x00, 0x03, 0x69, 0x91, 0x22, 0x44, 0x78, 0x10, 0x70, 0x00,
+	// @768 'r' (6 pixels wide)
+	0x00, 0x00, 0x36, 0x61, 0x04, 0x10, 0xF8, 0x00, 0x00,
+	// @777 's' (6 pixels wide)
+	0x00, 0x00, 0x1E, 0x89, 0xC0, 0xA2, 0xF0, 0x00, 0x00,
+	// @786 't' (7 pixels wide)
+	0x00, 0x01, 0x07, 0xC4, 0x08, 0x10, 0x22, 0x38, 0x00, 0x00, 0x00,
+	// @797 'u' (8 pixels wide)
+	0x00, 0x00, 0x00, 0xCC, 0x44, 0x44, 0x44, 0x4C, 0x36, 0x00, 0x00, 0x00,
+	// @809 'v' (8 pixels wide)
+	0x00, 0x00, 0x00, 0xEE, 0x44, 0x44, 0x28, 0x28, 0x10, 0x00, 0x00, 0x00,
+	// @821 'w' (8 pixels wide)
+	0x00, 0x00, 0x00, 0xEE, 0x44, 0x54, 0x54, 0x54, 0x28, 0x00, 0x00, 0x00,
+	// @833 'x' (7 pixels wide)
+	0x00, 0x00, 0x06, 0x64, 0x86, 0x0C, 0x24, 0xCC, 0x00, 0x00, 0x00,
+	// @844 'y' (8 pixels wide)
+	0x00, 0x00, 0x00, 0xEE, 0x44, 0x24, 0x28, 0x18, 0x10, 0x10, 0x78, 0x00,
+	// @856 'z' (6 pixels wide)
+	0x00, 0x00, 0x3E, 0x90, 0x84, 0x22, 0xF8, 0x00, 0x00,
+	// @865 '{' (4 pixels wide)
+	0x02, 0x44, 0x44, 0x84, 0x44, 0x20,
+	// @871 '|' (2 pixels wide)
+	0x2A, 0xAA, 0xA0,
+	// @874 '}' (4 pixels wide)
+	0x08, 0x44, 0x44, 0x24, 0x44, 0x80,
+	// @880 '~' (6 pixels wide)
+	0x00, 0x00, 0x00, 0x01, 0x2B, 0x00, 0x00, 0x00, 0x00,
+};
+
+const uint8_t Font12V_Widths[] PROGMEM = 
+{
+	4, 2, 6, 6, 5, 6, 6, 2, 3, 3, 6, 8, 4, 6, 3, 6,
+	6, 6, 6, 6, 7, 6, 6, 6, 6, 6, 3, 4, 7, 6, 7, 5,
+	6, 8, 7, 6, 7, 7, 7, 7, 8, 6, 6, 8, 6, 8, 8, 6,
+	6, 6, 8, 6, 8, 8, 8, 8, 8, 8, 6, 4, 5, 4, 6, 8,
+	3, 7, 7, 6, 7, 6, 6, 7, 8, 6, 5, 7, 6, 8, 8, 6,
+	7, 7, 6, 6, 7, 8, 8, 8, 7, 8, 6, 4, 2, 4, 6,
+};
+
+const uint16_t Font12V_Offsets[] PROGMEM = 
+{
+	0, 6, 9, 18, 27, 35, 44, 53, 56, 61, 66, 75,
+	87, 93, 102, 107, 116, 125, 134, 143, 152, 163, 172, 181,
+	190, 199, 208, 213, 219, 230, 239, 250, 258, 267, 279, 290,
+	299, 310, 321, 332, 343, 355, 364, 373, 385, 394, 406, 418,
+	427, 436, 445, 457, 466, 478, 490, 502, 514, 526, 538, 547,
+	553, 561, 567, 576, 588, 593, 604, 615, 624, 635, 644, 653,
+	664, 676, 685, 693, 704, 713, 725, 737, 746, 757, 768, 777,
+	786, 797, 809, 821, 833, 844, 856, 865, 871, 874, 880,
+};
+
+sFONT Font12V = {
+  Font12V_Table,
+  6, /* Width: mean advance */
+  12, /* Height */
+  FONT_FORMAT_PROP,
+  Font12V_Widths,
+  Font12V_Offsets,
+};
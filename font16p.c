@@ -0,0 +1,205 @@
+/* Packed Font16 generated by tools/fontpack.py from font16.c, do not edit.
+   11 x 16 glyphs, 22 bytes per glyph. */
+
+#include "fonts.h"
+
+const uint8_t Font16P_Table[] PROGMEM = 
+{
+	// @0 ' '
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @22 '!'
+	0x00, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @44 '"'
+	0x00, 0x00, 0x00, 0x77, 0x0E, 0xE0, 0x88, 0x11, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @66 '#'
+	0x00, 0x01, 0xB0, 0x36, 0x06, 0xC0, 0xD8, 0x7F, 0x86, 0xC1, 0xFE, 0x1B, 0x03, 0x60, 0x6C, 0x0D, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @88 '$'
+	0x04, 0x03, 0xF0, 0xC6, 0x18, 0xC3, 0x80, 0x3C, 0x03, 0xC0, 0x1C, 0x31, 0x86, 0x30, 0xFC, 0x02, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+	// @110 '%'
+	0x00, 0x03, 0x00, 0x90, 0x12, 0x01, 0x8C, 0x0F, 0x07, 0x81, 0x8C, 0x02, 0x40, 0x48, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @132 '&'
+	0x00, 0x00, 0x00, 0x3C, 0x0C, 0x01, 0x80, 0x30, 0x03, 0x00, 0xEC, 0x37, 0x06, 0x60, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @154 '''
+	0x00, 0x00, 0x00, 0x1C, 0x03, 0x80, 0x20, 0x04, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @176 '('
+	0x00, 0x00, 0x60, 0x0C, 0x03, 0x00, 0xE0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0xC0, 0x18, 0x01, 0x80, 0x30, 0x00, 0x00, 0x00, 0x00,
+	// @198 ')'
+	0x00, 0x03, 0x00, 0x60, 0x06, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x30, 0x0E, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00,
+	// @220 '*'
+	0x00, 0x00, 0xC0, 0x18, 0x1F, 0xE3, 0xFC, 0x1E, 0x07, 0xE0, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @242 '+'
+	0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x40, 0x08, 0x0F, 0xE0, 0x20, 0x04, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @264 ','
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x10, 0x06, 0x00, 0x80, 0x10, 0x00, 0x00, 0x00,
+	// @286 '-'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @308 '.'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @330 '/'
+	0x00, 0xC0, 0x18, 0x06, 0x00, 0xC0, 0x30, 0x06, 0x01, 0x80, 0x60, 0x0C, 0x03, 0x00, 0x60, 0x18, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @352 '0'
+	0x00, 0x01, 0xC0, 0x6C, 0x18, 0xC3, 0x18, 0x63, 0x0C, 0x61, 0x8C, 0x31, 0x83, 0x60, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @374 '1'
+	0x00, 0x00, 0xC0, 0xF8, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @396 '2'
+	0x00, 0x01, 0xE0, 0x66, 0x18, 0xC3, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @418 '3'
+	0x00, 0x07, 0xE1, 0x86, 0x00, 0xC0, 0x30, 0x3E, 0x00, 0xE0, 0x0C, 0x01, 0x8C, 0x30, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @440 '4'
+	0x00, 0x00, 0xE0, 0x1C, 0x07, 0x80, 0xB0, 0x36, 0x04, 0xC1, 0x98, 0x3F, 0x80, 0x60, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @462 '5'
+	0x00, 0x03, 0xF0, 0x60, 0x0C, 0x01, 0x80, 0x3E, 0x04, 0x60, 0x0C, 0x01, 0x84, 0x30, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @484 '6'
+	0x00, 0x00, 0xF0, 0x70, 0x0C, 0x03, 0x00, 0x6E, 0x0E, 0x61, 0x8C, 0x31, 0x83, 0x30, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @506 '7'
+	0x00, 0x0F, 0xE1, 0x0C, 0x01, 0x80, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x0C, 0x01, 0x80, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @528 '8'
+	0x00, 0x03, 0xE0, 0xC6, 0x18, 0xC3, 0x18, 0x3E, 0x0C, 0x61, 0x8C, 0x31, 0x86, 0x30, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @550 '9'
+	0x00, 0x03, 0xC0, 0xCC, 0x18, 0xC3, 0x18, 0x67, 0x07, 0x60, 0x0C, 0x03, 0x00, 0xE0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @572 ':'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x18, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @594 ';'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x10, 0x04, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+	// @616 '<'
+	0x00, 0x00, 0x00, 0x03, 0x01, 0x80, 0x40, 0x30, 0x18, 0x00, 0xC0, 0x04, 0x00, 0x60, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @638 '='
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @660 '>'
+	0x00, 0x00, 0x01, 0x80, 0x0C, 0x00, 0x40, 0x06, 0x00, 0x30, 0x18, 0x04, 0x03, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @682 '?'
+	0x00, 0x00, 0x00, 0x7C, 0x18, 0xC3, 0x18, 0x03, 0x01, 0xC0, 0x60, 0x0C, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @704 '@'
+	0x00, 0x01, 0xC0, 0x44, 0x10, 0x82, 0x10, 0x4E, 0x0A, 0x41, 0x48, 0x27, 0x04, 0x00, 0x44, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @726 'A'
+	0x00, 0x00, 0x00, 0xFC, 0x07, 0x80, 0x90, 0x33, 0x06, 0x60, 0xFC, 0x30, 0xC6, 0x19, 0xE7, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @748 'B'
+	0x00, 0x00, 0x01, 0xFC, 0x18, 0xC3, 0x18, 0x63, 0x0F, 0xC1, 0x8C, 0x31, 0x86, 0x31, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @770 'C'
+	0x00, 0x00, 0x00, 0x7D, 0x18, 0x66, 0x04, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x46, 0x10, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @792 'D'
+	0x00, 0x00, 0x01, 0xFC, 0x18, 0xC3, 0x0C, 0x61, 0x8C, 0x31, 0x86, 0x30, 0xC6, 0x31, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @814 'E'
+	0x00, 0x00, 0x01, 0xFE, 0x18, 0x43, 0x08, 0x64, 0x0F, 0x81, 0x90, 0x30, 0x86, 0x11, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @836 'F'
+	0x00, 0x00, 0x01, 0xFF, 0x18, 0x23, 0x04, 0x64, 0x0F, 0x81, 0x90, 0x30, 0x06, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @858 'G'
+	0x00, 0x00, 0x00, 0x7A, 0x18, 0xC6, 0x08, 0xC0, 0x18, 0x03, 0x3E, 0x61, 0x86, 0x30, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @880 'H'
+	0x00, 0x00, 0x01, 0xEF, 0x18, 0xC3, 0x18, 0x63, 0x0F, 0xE1, 0x8C, 0x31, 0x86, 0x31, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @902 'I'
+	0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @924 'J'
+	0x00, 0x00, 0x00, 0x7F, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC3, 0x18, 0x63, 0x0C, 0x60, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @946 'K'
+	0x00, 0x00, 0x01, 0xEF, 0x18, 0xC3, 0x30, 0x6C, 0x0F, 0x01, 0xF0, 0x33, 0x06, 0x31, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @968 'L'
+	0x00, 0x00, 0x01, 0xF8, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC2, 0x18, 0x43, 0x09, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @990 'M'
+	0x00, 0x00, 0x03, 0x83, 0xB0, 0x67, 0x1C, 0xF7, 0x9A, 0xB3, 0x76, 0x64, 0xCC, 0x1B, 0xEF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1012 'N'
+	0x00, 0x00, 0x01, 0xCF, 0x18, 0xC3, 0x98, 0x7B, 0x0D, 0x61, 0xBC, 0x33, 0x86, 0x31, 0xE6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1034 'O'
+	0x00, 0x00, 0x00, 0x7C, 0x18, 0xC6, 0x0C, 0xC1, 0x98, 0x33, 0x06, 0x60, 0xC6, 0x30, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1056 'P'
+	0x00, 0x00, 0x01, 0xFC, 0x18, 0xC3, 0x18, 0x63, 0x0C, 0x61, 0xF8, 0x30, 0x06, 0x01, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1078 'Q'
+	0x00, 0x00, 0x00, 0x7C, 0x18, 0xC6, 0x0C, 0xC1, 0x98, 0x33, 0x06, 0x60, 0xC6, 0x30, 0x7C, 0x06, 0x61, 0xF8, 0x00, 0x00, 0x00, 0x00,
+	// @1100 'R'
+	0x00, 0x00, 0x01, 0xFC, 0x18, 0xC3, 0x18, 0x63, 0x0F, 0x81, 0x98, 0x31, 0x86, 0x31, 0xF3, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1122 'S'
+	0x00, 0x00, 0x00, 0x7E, 0x18, 0xC3, 0x18, 0x70, 0x07, 0xC0, 0x1C, 0x31, 0x86, 0x30, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1144 'T'
+	0x00, 0x00, 0x01, 0xFE, 0x26, 0x44, 0xC8, 0x99, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1166 'U'
+	0x00, 0x00, 0x01, 0xEF, 0x18, 0xC3, 0x18, 0x63, 0x0C, 0x61, 0x8C, 0x31, 0x86, 0x30, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1188 'V'
+	0x00, 0x00, 0x01, 0xEF, 0x18, 0xC3, 0x18, 0x36, 0x06, 0xC0, 0xD8, 0x0A, 0x01, 0xC0, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1210 'W'
+	0x00, 0x00, 0x03, 0xEF, 0xB0, 0x66, 0x4C, 0xDD, 0x9B, 0xB1, 0x54, 0x3B, 0x87, 0x70, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1232 'X'
+	0x00, 0x00, 0x01, 0xEF, 0x18, 0xC1, 0xB0, 0x1C, 0x03, 0x80, 0x70, 0x1B, 0x06, 0x31, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1254 'Y'
+	0x00, 0x00, 0x01, 0xE7, 0x98, 0x61, 0x98, 0x1E, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1276 'Z'
+	0x00, 0x00, 0x00, 0xFE, 0x10, 0xC2, 0x30, 0x0C, 0x01, 0x00, 0x60, 0x18, 0x86, 0x10, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1298 '['
+	0x00, 0x00, 0xF0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00,
+	// @1320 '\'
+	0x30, 0x06, 0x00, 0x60, 0x0C, 0x00, 0xC0, 0x18, 0x01, 0x80, 0x18, 0x03, 0x00, 0x30, 0x06, 0x00, 0x60, 0x0C, 0x00, 0x00, 0x00, 0x00,
+	// @1342 ']'
+	0x00, 0x03, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00,
+	// @1364 '^'
+	0x04, 0x01, 0x40, 0x28, 0x08, 0x82, 0x08, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1386 '_'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF,
+	// @1408 '`'
+	0x08, 0x00, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1430 'a'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x03, 0x00, 0x60, 0xFC, 0x31, 0x86, 0x70, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1452 'b'
+	0x00, 0x0E, 0x00, 0xC0, 0x18, 0x03, 0x70, 0x73, 0x0C, 0x31, 0x86, 0x30, 0xC7, 0x31, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1474 'c'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE8, 0x63, 0x18, 0x23, 0x00, 0x60, 0x86, 0x30, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1496 'd'
+	0x00, 0x00, 0x70, 0x06, 0x00, 0xC1, 0xD8, 0x67, 0x18, 0x63, 0x0C, 0x61, 0x86, 0x70, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1518 'e'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x63, 0x18, 0x33, 0xFE, 0x60, 0x06, 0x18, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1540 'f'
+	0x00, 0x00, 0xFC, 0x30, 0x06, 0x03, 0xF8, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1562 'g'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDC, 0x67, 0x18, 0x63, 0x0C, 0x61, 0x86, 0x70, 0x76, 0x00, 0xC0, 0x18, 0x3E, 0x00, 0x00, 0x00,
+	// @1584 'h'
+	0x00, 0x0E, 0x00, 0xC0, 0x18, 0x03, 0x70, 0x73, 0x0C, 0x61, 0x8C, 0x31, 0x86, 0x31, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1606 'i'
+	0x00, 0x00, 0xC0, 0x18, 0x00, 0x01, 0xE0, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1628 'j'
+	0x00, 0x00, 0xC0, 0x18, 0x00, 0x03, 0xF0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x7C, 0x00, 0x00, 0x00,
+	// @1650 'k'
+	0x00, 0x0E, 0x00, 0xC0, 0x18, 0x03, 0x78, 0x6C, 0x0F, 0x01, 0xE0, 0x36, 0x06, 0x61, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1672 'l'
+	0x00, 0x03, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1694 'm'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF8, 0x6D, 0x8D, 0xB1, 0xB6, 0x36, 0xC6, 0xD9, 0xDB, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1716 'n'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x70, 0x73, 0x0C, 0x61, 0x8C, 0x31, 0x86, 0x31, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1738 'o'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x63, 0x18, 0x33, 0x06, 0x60, 0xC6, 0x30, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1760 'p'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x70, 0x73, 0x0C, 0x31, 0x86, 0x30, 0xC7, 0x30, 0xDC, 0x18, 0x03, 0x00, 0xF8, 0x00, 0x00, 0x00,
+	// @1782 'q'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDC, 0x67, 0x18, 0x63, 0x0C, 0x61, 0x86, 0x70, 0x76, 0x00, 0xC0, 0x18, 0x0F, 0x80, 0x00, 0x00,
+	// @1804 'r'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xB8, 0x39, 0x86, 0x00, 0xC0, 0x18, 0x03, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1826 's'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x63, 0x0F, 0x00, 0xF8, 0x03, 0x86, 0x30, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1848 't'
+	0x00, 0x03, 0x00, 0x60, 0x0C, 0x07, 0xF0, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x10, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1870 'u'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x38, 0x63, 0x0C, 0x61, 0x8C, 0x31, 0x86, 0x70, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1892 'v'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xBC, 0x63, 0x0C, 0x60, 0xD8, 0x1B, 0x01, 0xC0, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1914 'w'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x1E, 0xC1, 0x99, 0x33, 0x76, 0x3B, 0x87, 0x70, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1936 'x'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xBC, 0x36, 0x03, 0x80, 0x70, 0x0E, 0x03, 0x61, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1958 'y'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x9E, 0x61, 0x86, 0x60, 0xCC, 0x0B, 0x01, 0xE0, 0x18, 0x03, 0x00, 0xC0, 0x7C, 0x00, 0x00, 0x00,
+	// @1980 'z'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0x43, 0x00, 0xC0, 0x70, 0x18, 0x06, 0x10, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2002 '{'
+	0x00, 0x00, 0xC0, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0xC0, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00,
+	// @2024 '|'
+	0x00, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00,
+	// @2046 '}'
+	0x00, 0x01, 0x80, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x18, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00,
+	// @2068 '~'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x09, 0x20, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+sFONT Font16P = {
+  Font16P_Table,
+  11, /* Width */
+  16, /* Height */
+  FONT_FORMAT_PACKED,
+};
@@ -0,0 +1,229 @@
+/* Proportional Font16V generated by tools/fontprop.py from font16.c, do not edit.
+   16 rows, advances 3..12 pixels. */
+
+#include "fonts.h"
+
+const uint8_t Font16V_Table[] PROGMEM = 
+{
+	// @0 ' ' (6 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @12 '!' (3 pixels wide)
+	0x1B, 0x6D, 0xB6, 0xC3, 0x00, 0x00,
+	// @18 '"' (8 pixels wide)
+	0x00, 0x00, 0xEE, 0xEE, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @34 '#' (9 pixels wide)
+	0x00, 0x1B, 0x0D, 0x86, 0xC3, 0x67, 0xF9, 0xB1, 0xFE, 0x6C, 0x36, 0x1B, 0x0D, 0x80, 0x00, 0x00, 0x00, 0x00,
+	// @52 '$' (8 pixels wide)
+	0x10, 0x7E, 0xC6, 0xC6, 0xE0, 0x78, 0x3C, 0x0E, 0xC6, 0xC6, 0xFC, 0x10, 0x10, 0x00, 0x00, 0x00,
+	// @68 '%' (9 pixels wide)
+	0x00, 0x30, 0x24, 0x12, 0x06, 0x30, 0xF1, 0xE1, 0x8C, 0x09, 0x04, 0x81, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @86 '&' (8 pixels wide)
+	0x00, 0x00, 0x3C, 0x60, 0x60, 0x60, 0x30, 0x76, 0xDC, 0xCC, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @102 ''' (4 pixels wide)
+	0x00, 0xEE, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00,
+	// @110 '(' (5 pixels wide)
+	0x01, 0x8C, 0xCE, 0x63, 0x18, 0xC7, 0x18, 0x63, 0x00, 0x00,
+	// @120 ')' (5 pixels wide)
+	0x06, 0x30, 0xC3, 0x18, 0xC6, 0x31, 0x99, 0xCC, 0x00, 0x00,
+	// @130 '*' (9 pixels wide)
+	0x00, 0x0C, 0x06, 0x1F, 0xEF, 0xF1, 0xE1, 0xF8, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @148 '+' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x10, 0x10, 0x10, 0xFE, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @164 ',' (4 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x06, 0x4C, 0x88, 0x00,
+	// @172 '-' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @188 '.' (3 pixels wide)
+	0x00, 0x00, 0x00, 0x1B, 0x00, 0x00,
+	// @194 '/' (9 pixels wide)
+	0x03, 0x01, 0x81, 0x80, 0xC0, 0xC0, 0x60, 0x60, 0x60, 0x30, 0x30, 0x18, 0x18, 0x0C, 0x00, 0x00, 0x00, 0x00,
+	// @212 '0' (8 pixels wide)
+	0x00, 0x38, 0x6C, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0xC6, 0x6C, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @228 '1' (9 pixels wide)
+	0x00, 0x0C, 0x3E, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @246 '2' (8 pixels wide)
+	0x00, 0x3C, 0x66, 0xC6, 0xC6, 0x0C, 0x18, 0x30, 0x60, 0xC0, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @262 '3' (9 pixels wide)
+	0x00, 0x3F, 0x30, 0xC0, 0x60, 0x61, 0xF0, 0x1C, 0x06, 0x03, 0x61, 0x9F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @280 '4' (8 pixels wide)
+	0x00, 0x1C, 0x1C, 0x3C, 0x2C, 0x6C, 0x4C, 0xCC, 0xFE, 0x0C, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @296 '5' (8 pixels wide)
+	0x00, 0x7E, 0x60, 0x60, 0x60, 0x7C, 0x46, 0x06, 0x06, 0x86, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @312 '6' (8 pixels wide)
+	0x00, 0x1E, 0x70, 0x60, 0xC0, 0xDC, 0xE6, 0xC6, 0xC6, 0x66, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @328 '7' (8 pixels wide)
+	0x00, 0xFE, 0x86, 0x06, 0x0C, 0x0C, 0x0C, 0x0C, 0x18, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @344 '8' (8 pixels wide)
+	0x00, 0x7C, 0xC6, 0xC6, 0xC6, 0x7C, 0xC6, 0xC6, 0xC6, 0xC6, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @360 '9' (8 pixels wide)
+	0x00, 0x78, 0xCC, 0xC6, 0xC6, 0xCE, 0x76, 0x06, 0x0C, 0x1C, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @376 ':' (3 pixels wide)
+	0x00, 0x0D, 0x80, 0x1B, 0x00, 0x00,
+	// @382 ';' (5 pixels wide)
+	0x00, 0x00, 0x03, 0x18, 0x00, 0x03, 0x11, 0x08, 0x00, 0x00,
+	// @392 '<' (10 pixels wide)
+	0x00, 0x00, 0x00, 0x18, 0x18, 0x08, 0x0C, 0x0C, 0x00, 0xC0, 0x08, 0x01, 0x80, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @412 '=' (10 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @432 '>' (10 pixels wide)
+	0x00, 0x00, 0x0C, 0x00, 0xC0, 0x08, 0x01, 0x80, 0x18, 0x18, 0x08, 0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @452 '?' (8 pixels wide)
+	0x00, 0x00, 0x7C, 0xC6, 0xC6, 0x06, 0x1C, 0x30, 0x30, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @468 '@' (7 pixels wide)
+	0x00, 0x71, 0x14, 0x28, 0x53, 0xA9, 0x52, 0x9D, 0x01, 0x11, 0xC0, 0x00, 0x00, 0x00,
+	// @482 'A' (11 pixels wide)
+	0x00, 0x00, 0x01, 0xF8, 0x0F, 0x01, 0x20, 0x66, 0x0C, 0xC1, 0xF8, 0x61, 0x8C, 0x33, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @504 'B' (9 pixels wide)
+	0x00, 0x00, 0x3F, 0x8C, 0x66, 0x33, 0x19, 0xF8, 0xC6, 0x63, 0x31, 0xBF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @522 'C' (10 pixels wide)
+	0x00, 0x00, 0x03, 0xE9, 0x86, 0xC0, 0xB0, 0x0C, 0x03, 0x00, 0xC0, 0x98, 0x43, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @542 'D' (10 pixels wide)
+	0x00, 0x00, 0x0F, 0xE1, 0x8C, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x98, 0xCF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @562 'E' (9 pixels wide)
+	0x00, 0x00, 0x3F, 0xCC, 0x26, 0x13, 0x21, 0xF0, 0xC8, 0x61, 0x30, 0xBF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @580 'F' (10 pixels wide)
+	0x00, 0x00, 0x0F, 0xF9, 0x82, 0x60, 0x99, 0x07, 0xC1, 0x90, 0x60, 0x18, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @600 'G' (10 pixels wide)
+	0x00, 0x00, 0x03, 0xD1, 0x8C, 0xC1, 0x30, 0x0C, 0x03, 0x3E, 0xC3, 0x18, 0xC3, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @620 'H' (10 pixels wide)
+	0x00, 0x00, 0x0F, 0x79, 0x8C, 0x63, 0x18, 0xC7, 0xF1, 0x8C, 0x63, 0x18, 0xCF, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @640 'I' (9 pixels wide)
+	0x00, 0x00, 0x3F, 0xC3, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @658 'J' (10 pixels wide)
+	0x00, 0x00, 0x03, 0xF8, 0x18, 0x06, 0x01, 0x80, 0x63, 0x18, 0xC6, 0x31, 0x87, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @678 'K' (10 pixels wide)
+	0x00, 0x00, 0x0F, 0x79, 0x8C, 0x66, 0x1B, 0x07, 0x81, 0xF0, 0x66, 0x18, 0xCF, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @698 'L' (10 pixels wide)
+	0x00, 0x00, 0x0F, 0xC0, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC2, 0x30, 0x8C, 0x2F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @718 'M' (12 pixels wide)
+	0x00, 0x00, 0x00, 0xE0, 0xE6, 0x0C, 0x71, 0xC7, 0xBC, 0x6A, 0xC6, 0xEC, 0x64, 0xC6, 0x0C, 0xFB, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @742 'N' (10 pixels wide)
+	0x00, 0x00, 0x0E, 0x79, 0x8C, 0x73, 0x1E, 0xC6, 0xB1, 0xBC, 0x67, 0x18, 0xCF, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @762 'O' (10 pixels wide)
+	0x00, 0x00, 0x03, 0xE1, 0x8C, 0xC1, 0xB0, 0x6C, 0x1B, 0x06, 0xC1, 0x98, 0xC3, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @782 'P' (9 pixels wide)
+	0x00, 0x00, 0x3F, 0x8C, 0x66, 0x33, 0x19, 0x8C, 0xFC, 0x60, 0x30, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @800 'Q' (10 pixels wide)
+	0x00, 0x00, 0x03, 0xE1, 0x8C, 0xC1, 0xB0, 0x6C, 0x1B, 0x06, 0xC1, 0x98, 0xC3, 0xE0, 0x66, 0x3F, 0x00, 0x00, 0x00, 0x00,
+	// @820 'R' (11 pixels wide)
+	0x00, 0x00, 0x03, 0xF8, 0x31, 0x86, 0x30, 0xC6, 0x1F, 0x03, 0x30, 0x63, 0x0C, 0x63, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @842 'S' (8 pixels wide)
+	0x00, 0x00, 0x7E, 0xC6, 0xC6, 0xE0, 0x7C, 0x0E, 0xC6, 0xC6, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @858 'T' (9 pixels wide)
+	0x00, 0x00, 0x3F, 0xD3, 0x29, 0x94, 0xC8, 0x60, 0x30, 0x18, 0x0C, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @876 'U' (10 pixels wide)
+	0x00, 0x00, 0x0F, 0x79, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xC3, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @896 'V' (10 pixels wide)
+	0x00, 0x00, 0x0F, 0x79, 0x8C, 0x63, 0x0D, 0x83, 0x60, 0xD8, 0x14, 0x07, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @916 'W' (12 pixels wide)
+	0x00, 0x00, 0x00, 0xFB, 0xE6, 0x0C, 0x64, 0xC6, 0xEC, 0x6E, 0xC2, 0xA8, 0x3B, 0x83, 0xB8, 0x31, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @940 'X' (10 pixels wide)
+	0x00, 0x00, 0x0F, 0x79, 0x8C, 0x36, 0x07, 0x01, 0xC0, 0x70, 0x36, 0x18, 0xCF, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @960 'Y' (11 pixels wide)
+	0x00, 0x00, 0x03, 0xCF, 0x30, 0xC3, 0x30, 0x3C, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @982 'Z' (8 pixels wide)
+	0x00, 0x00, 0xFE, 0x86, 0x8C, 0x18, 0x10, 0x30, 0x62, 0xC2, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @998 '[' (5 pixels wide)
+	0x07, 0xB1, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0x8F, 0x00, 0x00,
+	// @1008 '\' (9 pixels wide)
+	0xC0, 0x60, 0x18, 0x0C, 0x03, 0x01, 0x80, 0x60, 0x18, 0x0C, 0x03, 0x01, 0x80, 0x60, 0x30, 0x00, 0x00, 0x00,
+	// @1026 ']' (5 pixels wide)
+	0x07, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0x8C, 0x6F, 0x00, 0x00,
+	// @1036 '^' (8 pixels wide)
+	0x10, 0x28, 0x28, 0x44, 0x82, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1052 '_' (12 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE,
+	// @1076 '`' (4 pixels wide)
+	0x84, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1084 'a' (9 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x30, 0x18, 0xFC, 0xC6, 0x67, 0x1D, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1102 'b' (10 pixels wide)
+	0x00, 0x38, 0x06, 0x01, 0x80, 0x6E, 0x1C, 0xC6, 0x19, 0x86, 0x61, 0x9C, 0xCE, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1122 'c' (9 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x03, 0xD3, 0x1B, 0x05, 0x80, 0xC1, 0x31, 0x8F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1140 'd' (10 pixels wide)
+	0x00, 0x01, 0xC0, 0x30, 0x0C, 0x3B, 0x19, 0xCC, 0x33, 0x0C, 0xC3, 0x19, 0xC3, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1160 'e' (10 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x18, 0xCC, 0x1B, 0xFE, 0xC0, 0x18, 0x63, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1180 'f' (10 pixels wide)
+	0x00, 0x07, 0xE3, 0x00, 0xC0, 0xFE, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1200 'g' (10 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x99, 0xCC, 0x33, 0x0C, 0xC3, 0x19, 0xC3, 0xB0, 0x0C, 0x03, 0x0F, 0x80, 0x00, 0x00,
+	// @1220 'h' (10 pixels wide)
+	0x00, 0x38, 0x06, 0x01, 0x80, 0x6E, 0x1C, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xCF, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1240 'i' (9 pixels wide)
+	0x00, 0x0C, 0x06, 0x00, 0x07, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1258 'j' (7 pixels wide)
+	0x00, 0x30, 0x60, 0x0F, 0xC1, 0x83, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xDF, 0x00, 0x00,
+	// @1272 'k' (10 pixels wide)
+	0x00, 0x38, 0x06, 0x01, 0x80, 0x6F, 0x1B, 0x07, 0x81, 0xE0, 0x6C, 0x19, 0x8E, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1292 'l' (9 pixels wide)
+	0x00, 0x3C, 0x06, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1310 'm' (11 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0xDB, 0x1B, 0x63, 0x6C, 0x6D, 0x8D, 0xB3, 0xB7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1332 'n' (10 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xEE, 0x1C, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xCF, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1352 'o' (10 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x18, 0xCC, 0x1B, 0x06, 0xC1, 0x98, 0xC3, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1372 'p' (10 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xEE, 0x1C, 0xC6, 0x19, 0x86, 0x61, 0x9C, 0xC6, 0xE1, 0x80, 0x60, 0x3E, 0x00, 0x00, 0x00,
+	// @1392 'q' (10 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x99, 0xCC, 0x33, 0x0C, 0xC3, 0x19, 0xC3, 0xB0, 0x0C, 0x03, 0x03, 0xE0, 0x00, 0x00,
+	// @1412 'r' (10 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x0E, 0x63, 0x00, 0xC0, 0x30, 0x0C, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1432 's' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x7E, 0xC6, 0xF0, 0x7C, 0x0E, 0xC6, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1448 't' (9 pixels wide)
+	0x00, 0x18, 0x0C, 0x06, 0x0F, 0xE1, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x87, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1466 'u' (10 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xE7, 0x18, 0xC6, 0x31, 0x8C, 0x63, 0x19, 0xC3, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1486 'v' (10 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x98, 0xC6, 0x30, 0xD8, 0x36, 0x07, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1506 'w' (12 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xE6, 0x0C, 0x64, 0xC6, 0xEC, 0x3B, 0x83, 0xB8, 0x31, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1530 'x' (10 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0x8D, 0x81, 0xC0, 0x70, 0x1C, 0x0D, 0x8F, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1550 'y' (11 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x3C, 0xC3, 0x0C, 0xC1, 0x98, 0x16, 0x03, 0xC0, 0x30, 0x06, 0x01, 0x80, 0xF8, 0x00, 0x00, 0x00,
+	// @1572 'z' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0xFE, 0x86, 0x0C, 0x38, 0x60, 0xC2, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1588 '{' (5 pixels wide)
+	0x01, 0x98, 0xC6, 0x31, 0x98, 0x63, 0x18, 0xC3, 0x00, 0x00,
+	// @1598 '|' (3 pixels wide)
+	0x1B, 0x6D, 0xB6, 0xDB, 0x6C, 0x00,
+	// @1604 '}' (5 pixels wide)
+	0x06, 0x18, 0xC6, 0x31, 0x86, 0x63, 0x18, 0xCC, 0x00, 0x00,
+	// @1614 '~' (8 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x92, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const uint8_t Font16V_Widths[] PROGMEM = 
+{
+	6, 3, 8, 9, 8, 9, 8, 4, 5, 5, 9, 8, 4, 8, 3, 9,
+	8, 9, 8, 9, 8, 8, 8, 8, 8, 8, 3, 5, 10, 10, 10, 8,
+	7, 11, 9, 10, 10, 9, 10, 10, 10, 9, 10, 10, 10, 12, 10, 10,
+	9, 10, 11, 8, 9, 10, 10, 12, 10, 11, 8, 5, 9, 5, 8, 12,
+	4, 9, 10, 9, 10, 10, 10, 10, 10, 9, 7, 10, 9, 11, 10, 10,
+	10, 10, 10, 8, 9, 10, 10, 12, 10, 11, 8, 5, 3, 5, 8,
+};
+
+const uint16_t Font16V_Offsets[] PROGMEM = 
+{
+	0, 12, 18, 34, 52, 68, 86, 102, 110, 120, 130, 148,
+	164, 172, 188, 194, 212, 228, 246, 262, 280, 296, 312, 328,
+	344, 360, 376, 382, 392, 412, 432, 452, 468, 482, 504, 522,
+	542, 562, 580, 600, 620, 640, 658, 678, 698, 718, 742, 762,
+	782, 800, 820, 842, 858, 876, 896, 916, 940, 960, 982, 998,
+	1008, 1026, 1036, 1052, 1076, 1084, 1102, 1122, 1140, 1160, 1180, 1200,
+	1220, 1240, 1258, 1272, 1292, 1310, 1332, 1352, 1372, 1392, 1412, 1432,
+	1448, 1466, 1486, 1506, 1530, 1550, 1572, 1588, 1598, 1604, 1614,
+};
+
+sFONT Font16V = {
+  Font16V_Table,
+  8, /* Width: mean advance */
+  16, /* Height */
+  FONT_FORMAT_PROP,
+  Font16V_Widths,
+  Font16V_Offsets,
+};
@@ -0,0 +1,205 @@
+/* Packed Font20 generated by tools/fontpack.py from font20.c, do not edit.
+   14 x 20 glyphs, 35 bytes per glyph. */
+
+#include "fonts.h"
+
+const uint8_t Font20P_Table[] PROGMEM = 
+{
+	// @0 ' '
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @35 '!'
+	0x00, 0x00, 0x1C, 0x00, 0x70, 0x01, 0xC0, 0x07, 0x00, 0x1C, 0x00, 0x70, 0x01, 0xC0, 0x02, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @70 '"'
+	0x00, 0x00, 0x00, 0x01, 0xCE, 0x07, 0x38, 0x1C, 0xE0, 0x21, 0x00, 0x84, 0x02, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @105 '#'
+	0x0C, 0xC0, 0x33, 0x00, 0xCC, 0x03, 0x30, 0x0C, 0xC0, 0xFF, 0xC3, 0xFF, 0x03, 0x30, 0x0C, 0xC0, 0xFF, 0xC3, 0xFF, 0x03, 0x30, 0x0C, 0xC0, 0x33, 0x00, 0xCC, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @140 '$'
+	0x03, 0x00, 0x0C, 0x00, 0x7E, 0x03, 0xF8, 0x18, 0x60, 0x60, 0x01, 0xF0, 0x03, 0xF0, 0x00, 0xE0, 0x61, 0x81, 0x86, 0x07, 0xF0, 0x1F, 0x80, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @175 '%'
+	0x00, 0x00, 0x70, 0x02, 0x20, 0x08, 0x80, 0x22, 0x00, 0x71, 0x80, 0x1E, 0x03, 0xE0, 0x3C, 0x00, 0xC7, 0x00, 0x22, 0x00, 0x88, 0x02, 0x20, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @210 '&'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0xE0, 0x30, 0x00, 0xC0, 0x01, 0x80, 0x0F, 0x30, 0x7F, 0xC1, 0x9E, 0x06, 0x30, 0x1F, 0xF0, 0x1E, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @245 '''
+	0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0xE0, 0x03, 0x80, 0x04, 0x00, 0x10, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @280 '('
+	0x00, 0x00, 0x03, 0x00, 0x0C, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0x30, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @315 ')'
+	0x00, 0x00, 0x30, 0x00, 0xC0, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x06, 0x00, 0x18, 0x00, 0x60, 0x03, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @350 '*'
+	0x00, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x1B, 0x60, 0x7F, 0x80, 0x78, 0x01, 0xE0, 0x0F, 0xC0, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @385 '+'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x0F, 0xFC, 0x3F, 0xF0, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @420 ','
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x0C, 0x00, 0x60, 0x01, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @455 '-'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @490 '.'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x80, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @525 '/'
+	0x00, 0x60, 0x01, 0x80, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x06, 0x00, 0x18, 0x00, 0xC0, 0x03, 0x00, 0x18, 0x00, 0x60, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x01, 0x80, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @560 '0'
+	0x00, 0x00, 0x3E, 0x01, 0xFC, 0x06, 0x30, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x06, 0x30, 0x1F, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @595 '1'
+	0x00, 0x00, 0x0C, 0x01, 0xF0, 0x07, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x1F, 0xE0, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @630 '2'
+	0x00, 0x00, 0x3E, 0x01, 0xFC, 0x0E, 0x38, 0x30, 0x60, 0x01, 0x80, 0x0C, 0x00, 0x60, 0x03, 0x00, 0x18, 0x00, 0xC0, 0x06, 0x00, 0x3F, 0xE0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @665 '3'
+	0x00, 0x00, 0x3E, 0x03, 0xFC, 0x0C, 0x38, 0x00, 0x60, 0x03, 0x80, 0x7C, 0x01, 0xF0, 0x00, 0xE0, 0x01, 0x80, 0x06, 0x18, 0x38, 0x7F, 0xC0, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @700 '4'
+	0x00, 0x00, 0x07, 0x00, 0x3C, 0x00, 0xF0, 0x06, 0xC0, 0x33, 0x00, 0xCC, 0x06, 0x30, 0x30, 0xC0, 0xFF, 0x83, 0xFE, 0x00, 0x30, 0x03, 0xE0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @735 '5'
+	0x00, 0x00, 0x7F, 0x01, 0xFC, 0x06, 0x00, 0x18, 0x00, 0x7E, 0x01, 0xFC, 0x06, 0x38, 0x00, 0x60, 0x01, 0x80, 0x06, 0x0C, 0x38, 0x3F, 0xC0, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @770 '6'
+	0x00, 0x00, 0x0F, 0x80, 0xFE, 0x07, 0x80, 0x18, 0x00, 0xE0, 0x03, 0x78, 0x0F, 0xF0, 0x38, 0xE0, 0xC1, 0x83, 0x06, 0x06, 0x38, 0x1F, 0xC0, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @805 '7'
+	0x00, 0x00, 0xFF, 0x83, 0xFE, 0x0C, 0x18, 0x00, 0x60, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @840 '8'
+	0x00, 0x00, 0x3E, 0x01, 0xFC, 0x0E, 0x38, 0x30, 0x60, 0xE3, 0x81, 0xFC, 0x07, 0xF0, 0x38, 0xE0, 0xC1, 0x83, 0x06, 0x0E, 0x38, 0x1F, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @875 '9'
+	0x00, 0x00, 0x3C, 0x01, 0xFC, 0x0E, 0x30, 0x30, 0x60, 0xC1, 0x83, 0x8E, 0x07, 0xF8, 0x0F, 0x60, 0x03, 0x80, 0x0C, 0x00, 0xF0, 0x3F, 0x80, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @910 ':'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x38, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x80, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @945 ';'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x1C, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x18, 0x00, 0x60, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @980 '<'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0xF0, 0x0F, 0x00, 0x70, 0x07, 0x00, 0x78, 0x00, 0x70, 0x00, 0x70, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1015 '='
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC7, 0xFF, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xC7, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1050 '>'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0x38, 0x00, 0x38, 0x00, 0x78, 0x03, 0x80, 0x38, 0x03, 0xC0, 0x3C, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1085 '?'
+	0x00, 0x00, 0x00, 0x00, 0xF8, 0x07, 0xF0, 0x18, 0x60, 0x61, 0x80, 0x06, 0x00, 0x70, 0x03, 0x80, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1120 '@'
+	0x00, 0x00, 0x0E, 0x00, 0xC8, 0x02, 0x10, 0x10, 0x40, 0x41, 0x01, 0x1C, 0x04, 0x90, 0x12, 0x40, 0x49, 0x01, 0x1C, 0x04, 0x00, 0x08, 0x00, 0x21, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1155 'A'
+	0x00, 0x00, 0x00, 0x01, 0xF8, 0x07, 0xE0, 0x03, 0x80, 0x1B, 0x00, 0x6C, 0x03, 0x30, 0x0C, 0x60, 0x7F, 0x81, 0xFE, 0x0C, 0x0C, 0x78, 0x79, 0xE1, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1190 'B'
+	0x00, 0x00, 0x00, 0x03, 0xF8, 0x0F, 0xF0, 0x18, 0x60, 0x61, 0x81, 0x8E, 0x07, 0xF0, 0x1F, 0xE0, 0x61, 0xC1, 0x83, 0x06, 0x0C, 0x3F, 0xF0, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1225 'C'
+	0x00, 0x00, 0x00, 0x00, 0x7B, 0x03, 0xFC, 0x1C, 0x70, 0xE0, 0xC3, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x83, 0x07, 0x1C, 0x0F, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1260 'D'
+	0x00, 0x00, 0x00, 0x07, 0xF8, 0x1F, 0xF0, 0x30, 0xE0, 0xC1, 0xC3, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0x07, 0x0C, 0x38, 0x7F, 0xC1, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1295 'E'
+	0x00, 0x00, 0x00, 0x03, 0xFF, 0x0F, 0xFC, 0x18, 0x30, 0x60, 0xC1, 0x98, 0x07, 0xE0, 0x1F, 0x80, 0x66, 0x01, 0x83, 0x06, 0x0C, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1330 'F'
+	0x00, 0x00, 0x00, 0x03, 0xFF, 0x0F, 0xFC, 0x18, 0x30, 0x60, 0xC1, 0x98, 0x07, 0xE0, 0x1F, 0x80, 0x66, 0x01, 0x80, 0x06, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1365 'G'
+	0x00, 0x00, 0x00, 0x00, 0x7B, 0x07, 0xFC, 0x18, 0x70, 0xC0, 0xC3, 0x00, 0x0C, 0x00, 0x31, 0xF8, 0xC7, 0xE3, 0x03, 0x06, 0x0C, 0x1F, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1400 'H'
+	0x00, 0x00, 0x00, 0x03, 0xCF, 0x0F, 0x3C, 0x18, 0x60, 0x61, 0x81, 0x86, 0x07, 0xF8, 0x1F, 0xE0, 0x61, 0x81, 0x86, 0x06, 0x18, 0x3C, 0xF0, 0xF3, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1435 'I'
+	0x00, 0x00, 0x00, 0x01, 0xFE, 0x07, 0xF8, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x1F, 0xE0, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1470 'J'
+	0x00, 0x00, 0x00, 0x00, 0x3F, 0x80, 0xFE, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x06, 0x0C, 0x38, 0x3F, 0xC0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1505 'K'
+	0x00, 0x00, 0x00, 0x03, 0xEF, 0x8F, 0xBE, 0x18, 0xE0, 0x66, 0x01, 0xB0, 0x07, 0xC0, 0x1D, 0x80, 0x63, 0x01, 0x8C, 0x06, 0x18, 0x3E, 0x78, 0xF8, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1540 'L'
+	0x00, 0x00, 0x00, 0x03, 0xF0, 0x0F, 0xC0, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0xC0, 0xC3, 0x03, 0x0C, 0x3F, 0xF0, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1575 'M'
+	0x00, 0x00, 0x00, 0x07, 0x87, 0x9E, 0x1E, 0x38, 0x70, 0xF3, 0xC3, 0x4B, 0x0D, 0xEC, 0x37, 0xB0, 0xCC, 0xC3, 0x33, 0x0C, 0x0C, 0x7C, 0xF9, 0xF3, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1610 'N'
+	0x00, 0x00, 0x00, 0x03, 0x9F, 0x0F, 0x7C, 0x1C, 0x60, 0x79, 0x81, 0xE6, 0x06, 0xD8, 0x1B, 0x60, 0x67, 0x81, 0x9E, 0x06, 0x38, 0x3E, 0xE0, 0xF9, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1645 'O'
+	0x00, 0x00, 0x00, 0x00, 0x78, 0x03, 0xF0, 0x1C, 0xE0, 0xE1, 0xC3, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0x87, 0x07, 0x38, 0x0F, 0xC0, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1680 'P'
+	0x00, 0x00, 0x00, 0x03, 0xFC, 0x0F, 0xF8, 0x18, 0x70, 0x60, 0xC1, 0x83, 0x06, 0x1C, 0x1F, 0xE0, 0x7F, 0x01, 0x80, 0x06, 0x00, 0x3F, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1715 'Q'
+	0x00, 0x00, 0x00, 0x00, 0x78, 0x03, 0xF0, 0x1C, 0xE0, 0xE1, 0xC3, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0x87, 0x07, 0x38, 0x0F, 0xC0, 0x1E, 0x00, 0x7B, 0x03, 0xFC, 0x0C, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1750 'R'
+	0x00, 0x00, 0x00, 0x03, 0xFC, 0x0F, 0xF8, 0x18, 0x70, 0x60, 0xC1, 0x87, 0x07, 0xF8, 0x1F, 0xC0, 0x63, 0x81, 0x86, 0x06, 0x1C, 0x3E, 0x38, 0xF8, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1785 'S'
+	0x00, 0x00, 0x00, 0x00, 0xFB, 0x07, 0xFC, 0x38, 0x70, 0xC0, 0xC3, 0x80, 0x07, 0xE0, 0x07, 0xE0, 0x01, 0xC3, 0x03, 0x0E, 0x1C, 0x3F, 0xE0, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1820 'T'
+	0x00, 0x00, 0x00, 0x03, 0xFF, 0x0F, 0xFC, 0x33, 0x30, 0xCC, 0xC3, 0x33, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1855 'U'
+	0x00, 0x00, 0x00, 0x03, 0xCF, 0x0F, 0x3C, 0x18, 0x60, 0x61, 0x81, 0x86, 0x06, 0x18, 0x18, 0x60, 0x61, 0x81, 0x86, 0x07, 0x38, 0x0F, 0xC0, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1890 'V'
+	0x00, 0x00, 0x00, 0x07, 0x8F, 0x1E, 0x3C, 0x30, 0x60, 0xC1, 0x81, 0x8C, 0x06, 0x30, 0x0D, 0x80, 0x36, 0x00, 0xD8, 0x01, 0xC0, 0x07, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1925 'W'
+	0x00, 0x00, 0x00, 0x07, 0xC7, 0xDF, 0x1F, 0x30, 0x18, 0xCE, 0x63, 0x39, 0x8C, 0xE6, 0x36, 0xD8, 0x5B, 0x41, 0xC7, 0x07, 0x1C, 0x1C, 0x70, 0x60, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1960 'X'
+	0x00, 0x00, 0x00, 0x07, 0x8F, 0x1E, 0x3C, 0x30, 0x60, 0x63, 0x00, 0xD8, 0x01, 0xC0, 0x07, 0x00, 0x36, 0x01, 0x8C, 0x0C, 0x18, 0x78, 0xF1, 0xE3, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1995 'Y'
+	0x00, 0x00, 0x00, 0x03, 0xCF, 0x0F, 0x3C, 0x18, 0x60, 0x33, 0x00, 0x78, 0x01, 0xE0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x0F, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2030 'Z'
+	0x00, 0x00, 0x00, 0x01, 0xFE, 0x07, 0xF8, 0x18, 0x60, 0x63, 0x00, 0x18, 0x00, 0xC0, 0x03, 0x00, 0x18, 0x00, 0xC6, 0x06, 0x18, 0x1F, 0xE0, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2065 '['
+	0x00, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xF0, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2100 '\'
+	0x18, 0x00, 0x60, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x60, 0x00, 0xC0, 0x03, 0x00, 0x06, 0x00, 0x18, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x06, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2135 ']'
+	0x00, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x03, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2170 '^'
+	0x00, 0x00, 0x08, 0x00, 0x70, 0x03, 0x60, 0x18, 0xC0, 0xC1, 0x82, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2205 '_'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF,
+	// @2240 '`'
+	0x00, 0x00, 0x10, 0x00, 0x30, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2275 'a'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x01, 0xFE, 0x00, 0x18, 0x0F, 0xE0, 0x7F, 0x83, 0x86, 0x0C, 0x38, 0x3F, 0xF0, 0x7D, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2310 'b'
+	0x00, 0x01, 0xC0, 0x07, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xDE, 0x03, 0xFE, 0x0E, 0x18, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0x0E, 0x18, 0x7F, 0xE1, 0xDE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2345 'c'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xC1, 0xFF, 0x06, 0x0C, 0x30, 0x30, 0xC0, 0x03, 0x00, 0x0E, 0x0C, 0x1F, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2380 'd'
+	0x00, 0x00, 0x01, 0xC0, 0x07, 0x00, 0x0C, 0x00, 0x30, 0x1E, 0xC1, 0xFF, 0x06, 0x1C, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0x0E, 0x1C, 0x1F, 0xF8, 0x1E, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2415 'e'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x01, 0xFE, 0x06, 0x18, 0x3F, 0xF0, 0xFF, 0xC3, 0x00, 0x06, 0x0C, 0x1F, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2450 'f'
+	0x00, 0x00, 0x0F, 0xC0, 0x7F, 0x01, 0x80, 0x06, 0x00, 0x7F, 0x81, 0xFE, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x1F, 0xE0, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2485 'g'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xE1, 0xFF, 0x86, 0x1C, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0x06, 0x1C, 0x1F, 0xF0, 0x1E, 0xC0, 0x03, 0x00, 0x1C, 0x0F, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x00,
+	// @2520 'h'
+	0x00, 0x00, 0xE0, 0x03, 0x80, 0x06, 0x00, 0x18, 0x00, 0x6F, 0x01, 0xFE, 0x07, 0x18, 0x18, 0x60, 0x61, 0x81, 0x86, 0x06, 0x18, 0x3C, 0xF0, 0xF3, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2555 'i'
+	0x00, 0x00, 0x0C, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x01, 0xF0, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x1F, 0xE0, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2590 'j'
+	0x00, 0x00, 0x0C, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x01, 0xFC, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x70, 0x3F, 0x80, 0xFC, 0x00, 0x00, 0x00, 0x00,
+	// @2625 'k'
+	0x00, 0x00, 0xE0, 0x03, 0x80, 0x06, 0x00, 0x18, 0x00, 0x6F, 0x81, 0xBE, 0x06, 0xC0, 0x1E, 0x00, 0x78, 0x01, 0xB0, 0x06, 0x60, 0x39, 0xF0, 0xE7, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2660 'l'
+	0x00, 0x00, 0x7C, 0x01, 0xF0, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x1F, 0xE0, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2695 'm'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFB, 0x87, 0xFF, 0x0C, 0xCC, 0x33, 0x30, 0xCC, 0xC3, 0x33, 0x0C, 0xCC, 0x7B, 0xB9, 0xEE, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2730 'n'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0x03, 0xFE, 0x07, 0x18, 0x18, 0x60, 0x61, 0x81, 0x86, 0x06, 0x18, 0x3C, 0xF0, 0xF3, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2765 'o'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x01, 0xFE, 0x06, 0x18, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0x06, 0x18, 0x1F, 0xE0, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2800 'p'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDE, 0x07, 0xFE, 0x0E, 0x18, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0x0E, 0x18, 0x3F, 0xE0, 0xDE, 0x03, 0x00, 0x0C, 0x00, 0x7C, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00,
+	// @2835 'q'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xE1, 0xFF, 0x86, 0x1C, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0x06, 0x1C, 0x1F, 0xF0, 0x1E, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0xF8, 0x03, 0xE0, 0x00, 0x00, 0x00,
+	// @2870 'r'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x83, 0xDF, 0x03, 0xCC, 0x0E, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2905 's'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x81, 0xFE, 0x06, 0x18, 0x1E, 0x00, 0x3F, 0x00, 0x1E, 0x06, 0x18, 0x1F, 0xE0, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2940 't'
+	0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0xFF, 0x83, 0xFE, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x0C, 0x0F, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2975 'u'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0x83, 0x8E, 0x06, 0x18, 0x18, 0x60, 0x61, 0x81, 0x86, 0x06, 0x38, 0x1F, 0xF0, 0x3D, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @3010 'v'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE3, 0xC7, 0x8F, 0x0C, 0x18, 0x18, 0xC0, 0x63, 0x00, 0xD8, 0x03, 0x60, 0x07, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @3045 'w'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE3, 0xC7, 0x8F, 0x0C, 0x98, 0x32, 0x60, 0xDF, 0x81, 0xDC, 0x07, 0x70, 0x18, 0xC0, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @3080 'x'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xC3, 0xCF, 0x03, 0x30, 0x07, 0x80, 0x0C, 0x00, 0x78, 0x03, 0x30, 0x3C, 0xF0, 0xF3, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @3115 'y'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE3, 0xC7, 0x8F, 0x0C, 0x18, 0x18, 0xC0, 0x63, 0x00, 0xD8, 0x03, 0xE0, 0x07, 0x00, 0x18, 0x00, 0x60, 0x03, 0x00, 0x7F, 0x01, 0xFC, 0x00, 0x00, 0x00, 0x00,
+	// @3150 'z'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x81, 0xFE, 0x06, 0x30, 0x01, 0x80, 0x0C, 0x00, 0x60, 0x03, 0x18, 0x1F, 0xE0, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @3185 '{'
+	0x00, 0x00, 0x07, 0x00, 0x3C, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x07, 0x00, 0x38, 0x00, 0x70, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xF0, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @3220 '|'
+	0x00, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @3255 '}'
+	0x00, 0x00, 0x70, 0x01, 0xE0, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x70, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0x60, 0x07, 0x80, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @3290 '~'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0xCC, 0x33, 0xF0, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+sFONT Font20P = {
+  Font20P_Table,
+  14, /* Width */
+  20, /* Height */
+  FONT_FORMAT_PACKED,
+};
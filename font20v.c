@@ -0,0 +1,229 @@
+/* Proportional Font20V generated by tools/fontprop.py from font20.c, do not edit.
+   20 rows, advances 3..15 pixels. */
+
+#include "fonts.h"
+
+const uint8_t Font20V_Table[] PROGMEM = 
+{
+	// @0 ' ' (7 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @18 '!' (4 pixels wide)
+	0x0E, 0xEE, 0xEE, 0xEE, 0x44, 0x00, 0xEE, 0x00, 0x00, 0x00,
+	// @28 '"' (9 pixels wide)
+	0x00, 0x00, 0x39, 0xDC, 0xEE, 0x72, 0x11, 0x08, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @51 '#' (11 pixels wide)
+	0x33, 0x06, 0x60, 0xCC, 0x19, 0x83, 0x31, 0xFF, 0xBF, 0xF1, 0x98, 0x33, 0x1F, 0xFB, 0xFF, 0x19, 0x83, 0x30, 0x66, 0x0C, 0xC1, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @79 '$' (9 pixels wide)
+	0x18, 0x0C, 0x0F, 0xCF, 0xEC, 0x36, 0x03, 0xE0, 0xFC, 0x07, 0x61, 0xB0, 0xDF, 0xCF, 0xC0, 0xC0, 0x60, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @102 '%' (10 pixels wide)
+	0x00, 0x1C, 0x08, 0x82, 0x20, 0x88, 0x1C, 0x60, 0x78, 0xF8, 0xF0, 0x31, 0xC0, 0x88, 0x22, 0x08, 0x81, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @127 '&' (10 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x7C, 0x7F, 0x18, 0x06, 0x00, 0xC0, 0x79, 0xBF, 0xEC, 0xF3, 0x18, 0xFF, 0x8F, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @152 ''' (4 pixels wide)
+	0x00, 0xEE, 0xE4, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @162 '(' (5 pixels wide)
+	0x01, 0x8C, 0xC6, 0x33, 0x18, 0xC6, 0x31, 0x86, 0x31, 0x86, 0x30, 0x00, 0x00,
+	// @175 ')' (5 pixels wide)
+	0x06, 0x30, 0xC6, 0x30, 0xC6, 0x31, 0x8C, 0x66, 0x31, 0x98, 0xC0, 0x00, 0x00,
+	// @188 '*' (9 pixels wide)
+	0x00, 0x0C, 0x06, 0x03, 0x0D, 0xB7, 0xF8, 0xF0, 0x78, 0x7E, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @211 '+' (11 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x07, 0xFE, 0xFF, 0xC1, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @239 ',' (5 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE6, 0x33, 0x18, 0x80, 0x00, 0x00,
+	// @252 '-' (10 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFE, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @277 '.' (4 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xEE, 0x00, 0x00, 0x00,
+	// @287 '/' (9 pixels wide)
+	0x03, 0x01, 0x81, 0x80, 0xC0, 0x60, 0x60, 0x30, 0x30, 0x18, 0x18, 0x0C, 0x0C, 0x06, 0x03, 0x03, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @310 '0' (10 pixels wide)
+	0x00, 0x0F, 0x87, 0xF1, 0x8C, 0xC1, 0xB0, 0x6C, 0x1B, 0x06, 0xC1, 0xB0, 0x6C, 0x19, 0x8C, 0x7F, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @335 '1' (9 pixels wide)
+	0x00, 0x0C, 0x3E, 0x1F, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x0F, 0xF7, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @358 '2' (10 pixels wide)
+	0x00, 0x0F, 0x87, 0xF3, 0x8E, 0xC1, 0x80, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x80, 0xFF, 0xBF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @383 '3' (11 pixels wide)
+	0x00, 0x03, 0xE1, 0xFE, 0x30, 0xE0, 0x0C, 0x03, 0x83, 0xE0, 0x7C, 0x01, 0xC0, 0x18, 0x03, 0x60, 0xEF, 0xF8, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @411 '4' (10 pixels wide)
+	0x00, 0x01, 0xC0, 0xF0, 0x3C, 0x1B, 0x0C, 0xC3, 0x31, 0x8C, 0xC3, 0x3F, 0xEF, 0xF8, 0x0C, 0x0F, 0x83, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @436 '5' (10 pixels wide)
+	0x00, 0x1F, 0xC7, 0xF1, 0x80, 0x60, 0x1F, 0x87, 0xF1, 0x8E, 0x01, 0x80, 0x60, 0x1B, 0x0E, 0xFF, 0x1F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @461 '6' (10 pixels wide)
+	0x00, 0x03, 0xE3, 0xF9, 0xE0, 0x60, 0x38, 0x0D, 0xE3, 0xFC, 0xE3, 0xB0, 0x6C, 0x19, 0x8E, 0x7F, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @486 '7' (10 pixels wide)
+	0x00, 0x3F, 0xEF, 0xFB, 0x06, 0x01, 0x80, 0xC0, 0x30, 0x0C, 0x06, 0x01, 0x80, 0x60, 0x30, 0x0C, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @511 '8' (10 pixels wide)
+	0x00, 0x0F, 0x87, 0xF3, 0x8E, 0xC1, 0xB8, 0xE7, 0xF1, 0xFC, 0xE3, 0xB0, 0x6C, 0x1B, 0x8E, 0x7F, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @536 '9' (10 pixels wide)
+	0x00, 0x0F, 0x07, 0xF3, 0x8C, 0xC1, 0xB0, 0x6E, 0x39, 0xFE, 0x3D, 0x80, 0xE0, 0x30, 0x3C, 0xFE, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @561 ':' (4 pixels wide)
+	0x00, 0x00, 0x0E, 0xEE, 0x00, 0x0E, 0xEE, 0x00, 0x00, 0x00,
+	// @571 ';' (6 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0xE3, 0x8E, 0x00, 0x00, 0x1C, 0x63, 0x0C, 0x20, 0x00, 0x00, 0x00,
+	// @586 '<' (12 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x01, 0xE0, 0x78, 0x0E, 0x03, 0x80, 0xF0, 0x03, 0x80, 0x0E, 0x00, 0x78, 0x01, 0xE0, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @616 '=' (12 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xE0, 0x00, 0x00, 0x0F, 0xFE, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @646 '>' (12 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0xF0, 0x03, 0xC0, 0x0E, 0x00, 0x38, 0x01, 0xE0, 0x38, 0x0E, 0x03, 0xC0, 0xF0, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @676 '?' (9 pixels wide)
+	0x00, 0x00, 0x1F, 0x1F, 0xCC, 0x36, 0x18, 0x0C, 0x1C, 0x1C, 0x0C, 0x00, 0x00, 0x03, 0x81, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @699 '@' (8 pixels wide)
+	0x00, 0x1C, 0x64, 0x42, 0x82, 0x82, 0x8E, 0x92, 0x92, 0x92, 0x8E, 0x80, 0x40, 0x42, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @719 'A' (13 pixels wide)
+	0x00, 0x00, 0x00, 0x0F, 0xC0, 0x7E, 0x00, 0x70, 0x06, 0xC0, 0x36, 0x03, 0x30, 0x18, 0xC1, 0xFE, 0x0F, 0xF0, 0xC0, 0xCF, 0x0F, 0x78, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @752 'B' (11 pixels wide)
+	0x00, 0x00, 0x03, 0xF8, 0x7F, 0x86, 0x18, 0xC3, 0x18, 0xE3, 0xF8, 0x7F, 0x8C, 0x39, 0x83, 0x30, 0x6F, 0xFD, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @780 'C' (11 pixels wide)
+	0x00, 0x00, 0x00, 0x7B, 0x1F, 0xE7, 0x1D, 0xC1, 0xB0, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x83, 0x38, 0xE3, 0xF8, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @808 'D' (12 pixels wide)
+	0x00, 0x00, 0x00, 0xFF, 0x0F, 0xF8, 0x61, 0xC6, 0x0E, 0x60, 0x66, 0x06, 0x60, 0x66, 0x06, 0x60, 0xE6, 0x1C, 0xFF, 0x8F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @838 'E' (11 pixels wide)
+	0x00, 0x00, 0x03, 0xFF, 0x7F, 0xE6, 0x0C, 0xC1, 0x99, 0x83, 0xF0, 0x7E, 0x0C, 0xC1, 0x83, 0x30, 0x6F, 0xFD, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @866 'F' (11 pixels wide)
+	0x00, 0x00, 0x03, 0xFF, 0x7F, 0xE6, 0x0C, 0xC1, 0x99, 0x83, 0xF0, 0x7E, 0x0C, 0xC1, 0x80, 0x30, 0x0F, 0xC1, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @894 'G' (12 pixels wide)
+	0x00, 0x00, 0x00, 0x1E, 0xC7, 0xFC, 0x61, 0xCC, 0x0C, 0xC0, 0x0C, 0x00, 0xC7, 0xEC, 0x7E, 0xC0, 0xC6, 0x0C, 0x7F, 0xC1, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @924 'H' (11 pixels wide)
+	0x00, 0x00, 0x03, 0xCF, 0x79, 0xE6, 0x18, 0xC3, 0x18, 0x63, 0xFC, 0x7F, 0x8C, 0x31, 0x86, 0x30, 0xCF, 0x3D, 0xE7, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @952 'I' (9 pixels wide)
+	0x00, 0x00, 0x3F, 0xDF, 0xE1, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x0F, 0xF7, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @975 'J' (12 pixels wide)
+	0x00, 0x00, 0x00, 0x0F, 0xE0, 0xFE, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0xC1, 0x8C, 0x18, 0xC1, 0x8C, 0x38, 0xFF, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1005 'K' (12 pixels wide)
+	0x00, 0x00, 0x00, 0xFB, 0xEF, 0xBE, 0x63, 0x86, 0x60, 0x6C, 0x07, 0xC0, 0x76, 0x06, 0x30, 0x63, 0x06, 0x18, 0xF9, 0xEF, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1035 'L' (11 pixels wide)
+	0x00, 0x00, 0x03, 0xF0, 0x7E, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x18, 0xC3, 0x18, 0x6F, 0xFD, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1063 'M' (13 pixels wide)
+	0x00, 0x00, 0x00, 0x3C, 0x3D, 0xE1, 0xE7, 0x0E, 0x3C, 0xF1, 0xA5, 0x8D, 0xEC, 0x6F, 0x63, 0x33, 0x19, 0x98, 0xC0, 0xCF, 0x9F, 0x7C, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1096 'N' (11 pixels wide)
+	0x00, 0x00, 0x03, 0x9F, 0x7B, 0xE7, 0x18, 0xF3, 0x1E, 0x63, 0x6C, 0x6D, 0x8C, 0xF1, 0x9E, 0x31, 0xCF, 0xB9, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1124 'O' (11 pixels wide)
+	0x00, 0x00, 0x00, 0x78, 0x1F, 0x87, 0x39, 0xC3, 0xB0, 0x36, 0x06, 0xC0, 0xD8, 0x1B, 0x87, 0x39, 0xC3, 0xF0, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1152 'P' (11 pixels wide)
+	0x00, 0x00, 0x03, 0xFC, 0x7F, 0xC6, 0x1C, 0xC1, 0x98, 0x33, 0x0E, 0x7F, 0x8F, 0xE1, 0x80, 0x30, 0x0F, 0xC1, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1180 'Q' (11 pixels wide)
+	0x00, 0x00, 0x00, 0x78, 0x1F, 0x87, 0x39, 0xC3, 0xB0, 0x36, 0x06, 0xC0, 0xD8, 0x1B, 0x87, 0x39, 0xC3, 0xF0, 0x3C, 0x07, 0xB1, 0xFE, 0x33, 0x80, 0x00, 0x00, 0x00, 0x00,
+	// @1208 'R' (12 pixels wide)
+	0x00, 0x00, 0x00, 0xFF, 0x0F, 0xF8, 0x61, 0xC6, 0x0C, 0x61, 0xC7, 0xF8, 0x7F, 0x06, 0x38, 0x61, 0x86, 0x1C, 0xF8, 0xEF, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1238 'S' (11 pixels wide)
+	0x00, 0x00, 0x00, 0xFB, 0x3F, 0xEE, 0x1D, 0x81, 0xB8, 0x03, 0xF0, 0x1F, 0x80, 0x3B, 0x03, 0x70, 0xEF, 0xF9, 0xBE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1266 'T' (11 pixels wide)
+	0x00, 0x00, 0x03, 0xFF, 0x7F, 0xEC, 0xCD, 0x99, 0xB3, 0x30, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1294 'U' (11 pixels wide)
+	0x00, 0x00, 0x03, 0xCF, 0x79, 0xE6, 0x18, 0xC3, 0x18, 0x63, 0x0C, 0x61, 0x8C, 0x31, 0x86, 0x39, 0xC3, 0xF0, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1322 'V' (12 pixels wide)
+	0x00, 0x00, 0x00, 0xF1, 0xEF, 0x1E, 0x60, 0xC6, 0x0C, 0x31, 0x83, 0x18, 0x1B, 0x01, 0xB0, 0x1B, 0x00, 0xE0, 0x0E, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1352 'W' (14 pixels wide)
+	0x00, 0x00, 0x00, 0x0F, 0x8F, 0xBE, 0x3E, 0x60, 0x31, 0x9C, 0xC6, 0x73, 0x19, 0xCC, 0x6D, 0xB0, 0xB6, 0x83, 0x8E, 0x0E, 0x38, 0x38, 0xE0, 0xC1, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1387 'X' (12 pixels wide)
+	0x00, 0x00, 0x00, 0xF1, 0xEF, 0x1E, 0x60, 0xC3, 0x18, 0x1B, 0x00, 0xE0, 0x0E, 0x01, 0xB0, 0x31, 0x86, 0x0C, 0xF1, 0xEF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1417 'Y' (11 pixels wide)
+	0x00, 0x00, 0x03, 0xCF, 0x79, 0xE6, 0x18, 0x66, 0x07, 0x80, 0xF0, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x03, 0xF0, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1445 'Z' (9 pixels wide)
+	0x00, 0x00, 0x3F, 0xDF, 0xEC, 0x36, 0x30, 0x30, 0x30, 0x18, 0x18, 0x18, 0xD8, 0x6F, 0xF7, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1468 '[' (5 pixels wide)
+	0x07, 0xBD, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0x8C, 0x63, 0x1E, 0xF0, 0x00, 0x00,
+	// @1481 '\' (9 pixels wide)
+	0xC0, 0x60, 0x18, 0x0C, 0x06, 0x01, 0x80, 0xC0, 0x30, 0x18, 0x06, 0x03, 0x00, 0xC0, 0x60, 0x30, 0x0C, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1504 ']' (5 pixels wide)
+	0x07, 0xBC, 0x63, 0x18, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xDE, 0xF0, 0x00, 0x00,
+	// @1517 '^' (10 pixels wide)
+	0x00, 0x02, 0x01, 0xC0, 0xD8, 0x63, 0x30, 0x68, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1542 '_' (15 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF7, 0xFF, 0xE0,
+	// @1580 '`' (5 pixels wide)
+	0x04, 0x18, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1593 'a' (11 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x1F, 0xE0, 0x0C, 0x3F, 0x8F, 0xF3, 0x86, 0x61, 0xCF, 0xFC, 0xFB, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1621 'b' (12 pixels wide)
+	0x00, 0x0E, 0x00, 0xE0, 0x06, 0x00, 0x60, 0x06, 0xF0, 0x7F, 0xC7, 0x0C, 0x60, 0x66, 0x06, 0x60, 0x67, 0x0C, 0xFF, 0xCE, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1651 'c' (11 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0x9F, 0xF3, 0x06, 0xC0, 0xD8, 0x03, 0x00, 0x70, 0x67, 0xFC, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1679 'd' (12 pixels wide)
+	0x00, 0x00, 0x1C, 0x01, 0xC0, 0x0C, 0x00, 0xC1, 0xEC, 0x7F, 0xC6, 0x1C, 0xC0, 0xCC, 0x0C, 0xC0, 0xCE, 0x1C, 0x7F, 0xE1, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1709 'e' (11 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x1F, 0xE3, 0x0C, 0xFF, 0xDF, 0xFB, 0x00, 0x30, 0x67, 0xFC, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1737 'f' (10 pixels wide)
+	0x00, 0x07, 0xE3, 0xF8, 0xC0, 0x30, 0x3F, 0xCF, 0xF0, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0xFF, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1762 'g' (12 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEE, 0x7F, 0xE6, 0x1C, 0xC0, 0xCC, 0x0C, 0xC0, 0xC6, 0x1C, 0x7F, 0xC1, 0xEC, 0x00, 0xC0, 0x1C, 0x3F, 0x83, 0xF0, 0x00, 0x00, 0x00,
+	// @1792 'h' (11 pixels wide)
+	0x00, 0x1C, 0x03, 0x80, 0x30, 0x06, 0x00, 0xDE, 0x1F, 0xE3, 0x8C, 0x61, 0x8C, 0x31, 0x86, 0x30, 0xCF, 0x3D, 0xE7, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1820 'i' (9 pixels wide)
+	0x00, 0x0C, 0x06, 0x00, 0x00, 0x07, 0xC3, 0xE0, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x0F, 0xF7, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1843 'j' (9 pixels wide)
+	0x00, 0x06, 0x03, 0x00, 0x00, 0x03, 0xF9, 0xFC, 0x06, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x0E, 0xFE, 0x7E, 0x00, 0x00, 0x00,
+	// @1866 'k' (11 pixels wide)
+	0x00, 0x1C, 0x03, 0x80, 0x30, 0x06, 0x00, 0xDF, 0x1B, 0xE3, 0x60, 0x78, 0x0F, 0x01, 0xB0, 0x33, 0x0E, 0x7D, 0xCF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1894 'l' (9 pixels wide)
+	0x00, 0x7C, 0x3E, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x0F, 0xF7, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1917 'm' (13 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0xE3, 0xFF, 0x8C, 0xCC, 0x66, 0x63, 0x33, 0x19, 0x98, 0xCC, 0xCF, 0x77, 0x7B, 0xB8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1950 'n' (11 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xDE, 0x3F, 0xE3, 0x8C, 0x61, 0x8C, 0x31, 0x86, 0x30, 0xCF, 0x3D, 0xE7, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1978 'o' (11 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x1F, 0xE3, 0x0C, 0xC0, 0xD8, 0x1B, 0x03, 0x30, 0xC7, 0xF8, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2006 'p' (12 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xF0, 0xFF, 0xC7, 0x0C, 0x60, 0x66, 0x06, 0x60, 0x67, 0x0C, 0x7F, 0xC6, 0xF0, 0x60, 0x06, 0x00, 0xF8, 0x0F, 0x80, 0x00, 0x00, 0x00,
+	// @2036 'q' (12 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEE, 0x7F, 0xE6, 0x1C, 0xC0, 0xCC, 0x0C, 0xC0, 0xC6, 0x1C, 0x7F, 0xC1, 0xEC, 0x00, 0xC0, 0x0C, 0x03, 0xE0, 0x3E, 0x00, 0x00, 0x00,
+	// @2066 'r' (11 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE7, 0x3D, 0xF1, 0xE6, 0x38, 0x06, 0x00, 0xC0, 0x18, 0x0F, 0xF1, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2094 's' (9 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFB, 0xFD, 0x86, 0xF0, 0x3F, 0x03, 0xD8, 0x6F, 0xF7, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2117 't' (11 pixels wide)
+	0x00, 0x00, 0x00, 0xC0, 0x18, 0x03, 0x01, 0xFF, 0x3F, 0xE1, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x63, 0xFC, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2145 'u' (11 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC7, 0x38, 0xE3, 0x0C, 0x61, 0x8C, 0x31, 0x86, 0x31, 0xC7, 0xFC, 0x7B, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2173 'v' (12 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x1E, 0xF1, 0xE6, 0x0C, 0x31, 0x83, 0x18, 0x1B, 0x01, 0xB0, 0x0E, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2203 'w' (12 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x1E, 0xF1, 0xE6, 0x4C, 0x64, 0xC6, 0xFC, 0x3B, 0x83, 0xB8, 0x31, 0x83, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2233 'x' (11 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE7, 0xBC, 0xF1, 0x98, 0x1E, 0x01, 0x80, 0x78, 0x19, 0x8F, 0x3D, 0xE7, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2261 'y' (12 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x1E, 0xF1, 0xE6, 0x0C, 0x31, 0x83, 0x18, 0x1B, 0x01, 0xF0, 0x0E, 0x00, 0xC0, 0x0C, 0x01, 0x80, 0xFE, 0x0F, 0xE0, 0x00, 0x00, 0x00,
+	// @2291 'z' (9 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFB, 0xFD, 0x8C, 0x0C, 0x0C, 0x0C, 0x0C, 0x6F, 0xF7, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2314 '{' (7 pixels wide)
+	0x00, 0x38, 0xF1, 0x83, 0x06, 0x0C, 0x18, 0x71, 0xC1, 0xC1, 0x83, 0x06, 0x0C, 0x1E, 0x1C, 0x00, 0x00, 0x00,
+	// @2332 '|' (3 pixels wide)
+	0x1B, 0x6D, 0xB6, 0xDB, 0x6D, 0xB6, 0xC0, 0x00,
+	// @2340 '}' (7 pixels wide)
+	0x01, 0xC3, 0xC1, 0x83, 0x06, 0x0C, 0x18, 0x38, 0x38, 0xE1, 0x83, 0x06, 0x0C, 0x78, 0xE0, 0x00, 0x00, 0x00,
+	// @2358 '~' (11 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x07, 0xE6, 0xCF, 0xC0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const uint8_t Font20V_Widths[] PROGMEM = 
+{
+	7, 4, 9, 11, 9, 10, 10, 4, 5, 5, 9, 11, 5, 10, 4, 9,
+	10, 9, 10, 11, 10, 10, 10, 10, 10, 10, 4, 6, 12, 12, 12, 9,
+	8, 13, 11, 11, 12, 11, 11, 12, 11, 9, 12, 12, 11, 13, 11, 11,
+	11, 11, 12, 11, 11, 11, 12, 14, 12, 11, 9, 5, 9, 5, 10, 15,
+	5, 11, 12, 11, 12, 11, 10, 12, 11, 9, 9, 11, 9, 13, 11, 11,
+	12, 12, 11, 9, 11, 11, 12, 12, 11, 12, 9, 7, 3, 7, 11,
+};
+
+const uint16_t Font20V_Offsets[] PROGMEM = 
+{
+	0, 18, 28, 51, 79, 102, 127, 152, 162, 175, 188, 211,
+	239, 252, 277, 287, 310, 335, 358, 383, 411, 436, 461, 486,
+	511, 536, 561, 571, 586, 616, 646, 676, 699, 719, 752, 780,
+	808, 838, 866, 894, 924, 952, 975, 1005, 1035, 1063, 1096, 1124,
+	1152, 1180, 1208, 1238, 1266, 1294, 1322, 1352, 1387, 1417, 1445, 1468,
+	1481, 1504, 1517, 1542, 1580, 1593, 1621, 1651, 1679, 1709, 1737, 1762,
+	1792, 1820, 1843, 1866, 1894, 1917, 1950, 1978, 2006, 2036, 2066, 2094,
+	2117, 2145, 2173, 2203, 2233, 2261, 2291, 2314, 2332, 2340, 2358,
+};
+
+sFONT Font20V = {
+  Font20V_Table,
+  9, /* Width: mean advance */
+  20, /* Height */
+  FONT_FORMAT_PROP,
+  Font20V_Widths,
+  Font20V_Offsets,
+};
@@ -37,7 +37,6 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "fonts.h"
-#include <avr/pgmspace.h>
 
 const uint8_t Font24_Table [] PROGMEM = 
 {
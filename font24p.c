@@ -0,0 +1,205 @@
+/* Packed Font24 generated by tools/fontpack.py from font24.c, do not edit.
+   17 x 24 glyphs, 51 bytes per glyph. */
+
+#include "fonts.h"
+
+const uint8_t Font24P_Table[] PROGMEM = 
+{
+	// @0 ' '
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @51 '!'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x20, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @102 '"'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xCE, 0x00, 0xE7, 0x00, 0x73, 0x80, 0x10, 0x80, 0x08, 0x40, 0x04, 0x20, 0x02, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @153 '#'
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x98, 0x00, 0xCC, 0x00, 0x66, 0x00, 0x33, 0x00, 0x19, 0x80, 0x7F, 0xF0, 0x3F, 0xF8, 0x03, 0x30, 0x03, 0x30, 0x07, 0xFF, 0x03, 0xFF, 0x80, 0x66, 0x00, 0x33, 0x00, 0x19, 0x80, 0x0C, 0xC0, 0x06, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @204 '$'
+	0x00, 0x00, 0x00, 0xC0, 0x00, 0x60, 0x00, 0xF6, 0x00, 0xFF, 0x00, 0xC3, 0x80, 0x61, 0xC0, 0x38, 0x00, 0x0F, 0x80, 0x03, 0xF0, 0x00, 0x3C, 0x03, 0x06, 0x01, 0xC3, 0x00, 0xE3, 0x80, 0x7F, 0x80, 0x37, 0x80, 0x01, 0x80, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @255 '%'
+	0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x01, 0xF8, 0x01, 0xCE, 0x00, 0xC3, 0x00, 0x61, 0x80, 0x39, 0xC0, 0x0F, 0xF8, 0x03, 0xF0, 0x07, 0xFC, 0x00, 0xE7, 0x00, 0x61, 0x80, 0x30, 0xC0, 0x1C, 0xE0, 0x07, 0xE0, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @306 '&'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x80, 0x31, 0x80, 0x18, 0x00, 0x0C, 0x00, 0x03, 0x00, 0x01, 0xC0, 0x01, 0xF3, 0x81, 0xDF, 0xC0, 0xC7, 0x80, 0x61, 0xC0, 0x1F, 0xF8, 0x07, 0xDC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @357 '''
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x04, 0x00, 0x02, 0x00, 0x01, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @408 '('
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x80, 0x03, 0x80, 0x01, 0xC0, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x0E, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @459 ')'
+	0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x03, 0x80, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x0E, 0x00, 0x0F, 0x00, 0x07, 0x00, 0x07, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @510 '*'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00, 0xED, 0xC0, 0x7F, 0xE0, 0x0F, 0xC0, 0x03, 0xC0, 0x01, 0xE0, 0x01, 0x98, 0x00, 0xCC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @561 '+'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x03, 0x00, 0x01, 0x80, 0x1F, 0xFE, 0x0F, 0xFF, 0x00, 0x30, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @612 ','
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x01, 0x80, 0x01, 0xC0, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x60, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @663 '-'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x07, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @714 '.'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @765 '/'
+	0x00, 0x18, 0x00, 0x0C, 0x00, 0x0E, 0x00, 0x06, 0x00, 0x07, 0x00, 0x03, 0x00, 0x01, 0x80, 0x01, 0x80, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x60, 0x00, 0x30, 0x00, 0x30, 0x00, 0x18, 0x00, 0x1C, 0x00, 0x0C, 0x00, 0x0E, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @816 '0'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0xFC, 0x00, 0xC3, 0x00, 0x61, 0x80, 0x60, 0x60, 0x30, 0x30, 0x18, 0x18, 0x0C, 0x0C, 0x06, 0x06, 0x03, 0x03, 0x01, 0x81, 0x80, 0x61, 0x80, 0x30, 0xC0, 0x0F, 0xC0, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @867 '1'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0xF0, 0x01, 0xF8, 0x00, 0xEC, 0x00, 0x06, 0x00, 0x03, 0x00, 0x01, 0x80, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x3F, 0xF0, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @918 '2'
+	0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x03, 0xFE, 0x03, 0x83, 0x01, 0x80, 0xC0, 0xC0, 0x60, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x70, 0x00, 0x70, 0x00, 0x60, 0x00, 0x60, 0x00, 0x60, 0x00, 0x7F, 0xF0, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @969 '3'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0xFC, 0x00, 0xC7, 0x00, 0x01, 0x80, 0x00, 0xC0, 0x00, 0xC0, 0x03, 0xC0, 0x01, 0xF0, 0x00, 0x1C, 0x00, 0x03, 0x00, 0x01, 0x80, 0x00, 0xC0, 0x60, 0xE0, 0x3F, 0xE0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1020 '4'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x1B, 0x00, 0x19, 0x80, 0x0C, 0xC0, 0x0C, 0x60, 0x06, 0x30, 0x06, 0x18, 0x06, 0x0C, 0x03, 0xFF, 0x81, 0xFF, 0xC0, 0x01, 0x80, 0x07, 0xF0, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1071 '5'
+	0x00, 0x00, 0x00, 0x00, 0x07, 0xFC, 0x03, 0xFE, 0x01, 0x80, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x37, 0x80, 0x1F, 0xF0, 0x0E, 0x18, 0x00, 0x06, 0x00, 0x03, 0x00, 0x01, 0x80, 0x00, 0xC0, 0xC0, 0xC0, 0x7F, 0xE0, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1122 '6'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x7F, 0x00, 0x70, 0x00, 0x70, 0x00, 0x30, 0x00, 0x30, 0x00, 0x1B, 0xC0, 0x0F, 0xF8, 0x07, 0x0C, 0x03, 0x03, 0x01, 0x81, 0x80, 0xC0, 0xC0, 0x30, 0xE0, 0x1F, 0xE0, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1173 '7'
+	0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x03, 0xFF, 0x01, 0x81, 0x80, 0xC1, 0xC0, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x70, 0x00, 0x30, 0x00, 0x18, 0x00, 0x1C, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x07, 0x00, 0x03, 0x00, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1224 '8'
+	0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x01, 0xFE, 0x01, 0xC3, 0x80, 0xC0, 0xC0, 0x60, 0x60, 0x18, 0x60, 0x07, 0xE0, 0x03, 0xF0, 0x03, 0x0C, 0x03, 0x03, 0x01, 0x81, 0x80, 0xC0, 0xC0, 0x70, 0xE0, 0x1F, 0xE0, 0x07, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1275 '9'
+	0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0x01, 0xFE, 0x01, 0xC3, 0x00, 0xC0, 0xC0, 0x60, 0x60, 0x30, 0x30, 0x0C, 0x38, 0x07, 0xFC, 0x00, 0xF6, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x80, 0x03, 0x80, 0x3F, 0x80, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1326 ':'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1377 ';'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x07, 0x00, 0x03, 0x00, 0x01, 0x80, 0x01, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1428 '<'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x01, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x03, 0xC0, 0x00, 0x78, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1479 '='
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF8, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x87, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1530 '>'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x03, 0xC0, 0x00, 0x78, 0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x0F, 0x00, 0x1E, 0x00, 0x3C, 0x00, 0x78, 0x00, 0xF0, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1581 '?'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0xFE, 0x00, 0xC3, 0x80, 0x60, 0xC0, 0x30, 0x60, 0x00, 0x70, 0x00, 0x70, 0x00, 0xF0, 0x00, 0x70, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1632 '@'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0xFE, 0x00, 0xE3, 0x80, 0x60, 0xC0, 0x61, 0xE0, 0x31, 0xF0, 0x19, 0xD8, 0x0C, 0xCC, 0x06, 0x66, 0x03, 0x33, 0x01, 0x8F, 0x80, 0xC3, 0xC0, 0x60, 0x00, 0x18, 0x00, 0x0E, 0x18, 0x03, 0xFC, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1683 'A'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x01, 0xFC, 0x00, 0x0E, 0x00, 0x0D, 0x80, 0x06, 0xC0, 0x06, 0x30, 0x03, 0x18, 0x03, 0x0C, 0x01, 0xFF, 0x01, 0xFF, 0x80, 0xC0, 0x60, 0xC0, 0x31, 0xF8, 0xFE, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1734 'B'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x07, 0xFF, 0x00, 0xC1, 0xC0, 0x60, 0x60, 0x30, 0x30, 0x18, 0x38, 0x0F, 0xF8, 0x07, 0xFE, 0x03, 0x03, 0x81, 0x80, 0xC0, 0xC0, 0x60, 0x60, 0x30, 0xFF, 0xF0, 0x7F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1785 'C'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x80, 0xFF, 0xC0, 0xE0, 0xE0, 0x60, 0x30, 0x60, 0x18, 0x30, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0xC0, 0x60, 0x70, 0x70, 0x1F, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1836 'D'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF8, 0x07, 0xFF, 0x00, 0xC1, 0xC0, 0x60, 0x60, 0x30, 0x18, 0x18, 0x0C, 0x0C, 0x06, 0x06, 0x03, 0x03, 0x01, 0x81, 0x80, 0xC0, 0xC0, 0xC0, 0x60, 0xE0, 0xFF, 0xE0, 0x7F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1887 'E'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0x07, 0xFF, 0x80, 0xC0, 0xC0, 0x60, 0x60, 0x33, 0x30, 0x19, 0x80, 0x0F, 0xC0, 0x07, 0xE0, 0x03, 0x30, 0x01, 0x99, 0x80, 0xC0, 0xC0, 0x60, 0x60, 0xFF, 0xF0, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1938 'F'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x83, 0xFF, 0xC0, 0x60, 0x60, 0x30, 0x30, 0x19, 0x98, 0x0C, 0xC0, 0x07, 0xE0, 0x03, 0xF0, 0x01, 0x98, 0x00, 0xCC, 0x00, 0x60, 0x00, 0x30, 0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1989 'G'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7D, 0x80, 0xFF, 0xC0, 0xE0, 0xE0, 0x60, 0x30, 0x60, 0x18, 0x30, 0x00, 0x18, 0x00, 0x0C, 0x3F, 0x86, 0x1F, 0xC3, 0x00, 0xC1, 0xC0, 0x60, 0x70, 0x70, 0x1F, 0xF8, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2040 'H'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xCF, 0xC7, 0xE7, 0xE0, 0xC0, 0xC0, 0x60, 0x60, 0x30, 0x30, 0x18, 0x18, 0x0F, 0xFC, 0x07, 0xFE, 0x03, 0x03, 0x01, 0x81, 0x80, 0xC0, 0xC0, 0x60, 0x60, 0xFC, 0xFC, 0x7E, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2091 'I'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x01, 0xFF, 0x80, 0x0C, 0x00, 0x06, 0x00, 0x03, 0x00, 0x01, 0x80, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x3F, 0xF0, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2142 'J'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0x01, 0x80, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x0C, 0x0C, 0x06, 0x06, 0x03, 0x03, 0x01, 0x81, 0x80, 0xC1, 0x80, 0x7F, 0xC0, 0x0F, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2193 'K'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xE7, 0xC7, 0xF3, 0xE0, 0xC1, 0x80, 0x61, 0x80, 0x31, 0x80, 0x19, 0x80, 0x0D, 0xC0, 0x07, 0xF0, 0x03, 0x9C, 0x01, 0x87, 0x00, 0xC1, 0x80, 0x60, 0xE0, 0xFE, 0x3E, 0x7F, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2244 'L'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF0, 0x07, 0xF8, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x03, 0x00, 0x01, 0x81, 0x80, 0xC0, 0xC0, 0x60, 0x60, 0x30, 0x30, 0xFF, 0xF8, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2295 'M'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x01, 0xEF, 0x81, 0xF1, 0xC0, 0xE0, 0xF0, 0xF0, 0x78, 0x78, 0x36, 0x6C, 0x1B, 0x36, 0x0C, 0xF3, 0x06, 0x79, 0x83, 0x18, 0xC1, 0x80, 0x60, 0xC0, 0x31, 0xFC, 0xFE, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2346 'N'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x1F, 0xC7, 0x8F, 0xE0, 0xE0, 0xC0, 0x78, 0x60, 0x3E, 0x30, 0x1B, 0x18, 0x0D, 0xCC, 0x06, 0x76, 0x03, 0x1B, 0x01, 0x8F, 0x80, 0xC3, 0xC0, 0x60, 0xE0, 0xFE, 0x30, 0x7F, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2397 'O'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0xFF, 0x00, 0xE1, 0xC0, 0x60, 0x60, 0x70, 0x38, 0x30, 0x0C, 0x18, 0x06, 0x0C, 0x03, 0x06, 0x01, 0x83, 0x81, 0xC0, 0xC0, 0xC0, 0x70, 0xE0, 0x1F, 0xE0, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2448 'P'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x03, 0xFF, 0x80, 0x60, 0xE0, 0x30, 0x30, 0x18, 0x18, 0x0C, 0x0C, 0x06, 0x0C, 0x03, 0xFE, 0x01, 0xFC, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2499 'Q'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0xFF, 0x00, 0xE1, 0xC0, 0x60, 0x60, 0x70, 0x38, 0x30, 0x0C, 0x18, 0x06, 0x0C, 0x03, 0x06, 0x01, 0x83, 0x81, 0xC0, 0xC0, 0xC0, 0x70, 0xE0, 0x1F, 0xE0, 0x07, 0xC0, 0x03, 0xE6, 0x03, 0xFF, 0x01, 0x87, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2550 'R'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFC, 0x07, 0xFF, 0x00, 0xC1, 0xC0, 0x60, 0x60, 0x30, 0x30, 0x18, 0x38, 0x0F, 0xF8, 0x07, 0xF0, 0x03, 0x1C, 0x01, 0x87, 0x00, 0xC1, 0x80, 0x60, 0xE0, 0xFE, 0x3C, 0x7F, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2601 'S'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0x00, 0xFF, 0x80, 0xE1, 0xC0, 0x60, 0x60, 0x30, 0x30, 0x1E, 0x00, 0x07, 0xE0, 0x00, 0xFC, 0x00, 0x0F, 0x01, 0x81, 0x80, 0xC0, 0xC0, 0x70, 0xE0, 0x3F, 0xE0, 0x1B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2652 'T'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0x83, 0xFF, 0xC1, 0x8C, 0x60, 0xC6, 0x30, 0x63, 0x18, 0x31, 0x8C, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x1F, 0xE0, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2703 'U'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xCF, 0xC7, 0xE7, 0xE0, 0xC0, 0xC0, 0x60, 0x60, 0x30, 0x30, 0x18, 0x18, 0x0C, 0x0C, 0x06, 0x06, 0x03, 0x03, 0x01, 0x81, 0x80, 0xC0, 0xC0, 0x30, 0xC0, 0x1F, 0xE0, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2754 'V'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xEF, 0xE7, 0xF7, 0xF0, 0xC0, 0x60, 0x30, 0x60, 0x18, 0x30, 0x0C, 0x18, 0x03, 0x18, 0x01, 0x8C, 0x00, 0x6C, 0x00, 0x36, 0x00, 0x1B, 0x00, 0x07, 0x00, 0x03, 0x80, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2805 'W'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC7, 0xFF, 0xE3, 0xF9, 0x80, 0x30, 0xC0, 0x18, 0x61, 0x0C, 0x19, 0xCC, 0x0C, 0xE6, 0x06, 0xDB, 0x03, 0x6D, 0x81, 0xE7, 0xC0, 0x71, 0xC0, 0x38, 0xE0, 0x18, 0x30, 0x0C, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2856 'X'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xCF, 0xC7, 0xE7, 0xE0, 0xC0, 0xC0, 0x30, 0xC0, 0x0C, 0xC0, 0x03, 0xC0, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x78, 0x00, 0x66, 0x00, 0x61, 0x80, 0x60, 0x60, 0xFC, 0xFC, 0x7E, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2907 'Y'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x8F, 0xC7, 0xC7, 0xE0, 0xC0, 0xC0, 0x30, 0xC0, 0x0C, 0xC0, 0x06, 0x60, 0x01, 0xE0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x1F, 0xE0, 0x0F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2958 'Z'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x01, 0xFF, 0x80, 0xC0, 0xC0, 0x60, 0xC0, 0x30, 0xC0, 0x18, 0xC0, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0xC3, 0x00, 0xC1, 0x80, 0xC0, 0xC0, 0xC0, 0x60, 0x7F, 0xF0, 0x3F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @3009 '['
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x03, 0x00, 0x01, 0x80, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x03, 0x00, 0x01, 0x80, 0x00, 0xC0, 0x00, 0x7C, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @3060 '\'
+	0x18, 0x00, 0x0C, 0x00, 0x07, 0x00, 0x01, 0x80, 0x00, 0xE0, 0x00, 0x30, 0x00, 0x18, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x03, 0x00, 0x01, 0x80, 0x00, 0xE0, 0x00, 0x30, 0x00, 0x1C, 0x00, 0x06, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @3111 ']'
+	0x00, 0x00, 0x00, 0x00, 0x03, 0xE0, 0x01, 0xF0, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x03, 0x00, 0x01, 0x80, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x03, 0x00, 0x01, 0x80, 0x00, 0xC0, 0x03, 0xE0, 0x01, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @3162 '^'
+	0x00, 0x00, 0x00, 0x40, 0x00, 0x70, 0x00, 0x7C, 0x00, 0x77, 0x00, 0x31, 0x80, 0x30, 0x60, 0x30, 0x18, 0x10, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @3213 '_'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0xFF, 0xFE,
+	// @3264 '`'
+	0x00, 0x00, 0x01, 0x80, 0x00, 0xE0, 0x00, 0x1C, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @3315 'a'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0xC0, 0x00, 0x30, 0x00, 0x18, 0x01, 0xFC, 0x03, 0xFE, 0x03, 0x83, 0x01, 0x81, 0x80, 0xC1, 0xC0, 0x3F, 0xF8, 0x0F, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @3366 'b'
+	0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x01, 0x80, 0x00, 0xC0, 0x00, 0x6F, 0x80, 0x3F, 0xF0, 0x1C, 0x18, 0x0C, 0x06, 0x06, 0x03, 0x03, 0x01, 0x81, 0x80, 0xC0, 0xC0, 0x60, 0x70, 0x60, 0xFF, 0xF0, 0x7B, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @3417 'c'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xB0, 0x1F, 0xF8, 0x1C, 0x1C, 0x1C, 0x06, 0x0C, 0x03, 0x06, 0x00, 0x03, 0x00, 0x01, 0xC0, 0x60, 0x70, 0x70, 0x1F, 0xF0, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @3468 'd'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x01, 0x80, 0x00, 0xC0, 0x1F, 0x60, 0x3F, 0xF0, 0x18, 0x38, 0x18, 0x0C, 0x0C, 0x06, 0x06, 0x03, 0x03, 0x01, 0x81, 0x80, 0xC0, 0x60, 0xE0, 0x3F, 0xFC, 0x07, 0xDE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @3519 'e'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0xF0, 0x18, 0x18, 0x18, 0x06, 0x0F, 0xFF, 0x07, 0xFF, 0x83, 0x00, 0x01, 0x80, 0x00, 0x60, 0x30, 0x3F, 0xF8, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @3570 'f'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x7F, 0x80, 0x60, 0x00, 0x30, 0x00, 0xFF, 0xE0, 0x7F, 0xF0, 0x06, 0x00, 0x03, 0x00, 0x01, 0x80, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00, 0x7F, 0xE0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @3621 'g'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x78, 0x3F, 0xFC, 0x18, 0x38, 0x18, 0x0C, 0x0C, 0x06, 0x06, 0x03, 0x03, 0x01, 0x81, 0x80, 0xC0, 0x60, 0xE0, 0x3F, 0xF0, 0x07, 0xD8, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x07, 0x00, 0xFF, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @3672 'h'
+	0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x01, 0x80, 0x00, 0xC0, 0x00, 0x6F, 0x80, 0x3F, 0xE0, 0x1C, 0x38, 0x0C, 0x0C, 0x06, 0x06, 0x03, 0x03, 0x01, 0x81, 0x80, 0xC0, 0xC0, 0x60, 0x60, 0xFC, 0xFC, 0x7E, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @3723 'i'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x3F, 0x00, 0x01, 0x80, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x7F, 0xF8, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @3774 'j'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xC0, 0x3F, 0xE0, 0x00, 0x30, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x03, 0x00, 0x01, 0x80, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x0E, 0x01, 0xFE, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @3825 'k'
+	0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x07, 0x80, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x33, 0xE0, 0x19, 0xF0, 0x0C, 0xC0, 0x06, 0xC0, 0x03, 0xE0, 0x01, 0xE0, 0x00, 0xF8, 0x00, 0x6E, 0x00, 0x33, 0x80, 0x78, 0xF8, 0x3C, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @3876 'l'
+	0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x03, 0xF0, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x03, 0x00, 0x01, 0x80, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x7F, 0xF8, 0x3F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @3927 'm'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xDD, 0xE1, 0xFF, 0xF8, 0x39, 0xCC, 0x18, 0xC6, 0x0C, 0x63, 0x06, 0x31, 0x83, 0x18, 0xC1, 0x8C, 0x60, 0xC6, 0x31, 0xFB, 0xDE, 0xFD, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @3978 'n'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0x80, 0xFF, 0xE0, 0x1C, 0x38, 0x0C, 0x0C, 0x06, 0x06, 0x03, 0x03, 0x01, 0x81, 0x80, 0xC0, 0xC0, 0x60, 0x60, 0xFC, 0xFC, 0x7E, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @4029 'o'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x1F, 0xE0, 0x1C, 0x38, 0x1C, 0x0E, 0x0C, 0x03, 0x06, 0x01, 0x83, 0x00, 0xC1, 0xC0, 0xE0, 0x70, 0xE0, 0x1F, 0xE0, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @4080 'p'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0x80, 0xFF, 0xF0, 0x1C, 0x18, 0x0C, 0x06, 0x06, 0x03, 0x03, 0x01, 0x81, 0x80, 0xC0, 0xC0, 0x60, 0x70, 0x60, 0x3F, 0xF0, 0x1B, 0xE0, 0x0C, 0x00, 0x06, 0x00, 0x03, 0x00, 0x07, 0xF0, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @4131 'q'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x78, 0x3F, 0xFC, 0x18, 0x38, 0x18, 0x0C, 0x0C, 0x06, 0x06, 0x03, 0x03, 0x01, 0x81, 0x80, 0xC0, 0x60, 0xE0, 0x3F, 0xF0, 0x07, 0xD8, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x03, 0x00, 0x0F, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x00,
+	// @4182 'r'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xE0, 0x7D, 0xF8, 0x07, 0xCC, 0x03, 0x80, 0x01, 0x80, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00, 0x7F, 0xE0, 0x3F, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @4233 's'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xE0, 0x1F, 0xF0, 0x18, 0x18, 0x0C, 0x0C, 0x07, 0xE0, 0x01, 0xFE, 0x00, 0x0F, 0x80, 0xC0, 0xC0, 0x60, 0xE0, 0x3F, 0xE0, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @4284 't'
+	0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x01, 0x80, 0x00, 0xC0, 0x00, 0x60, 0x00, 0xFF, 0xC0, 0x7F, 0xE0, 0x0C, 0x00, 0x06, 0x00, 0x03, 0x00, 0x01, 0x80, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x30, 0x70, 0x0F, 0xF8, 0x03, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @4335 'u'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE1, 0xE0, 0xF0, 0xF0, 0x18, 0x18, 0x0C, 0x0C, 0x06, 0x06, 0x03, 0x03, 0x01, 0x81, 0x80, 0xC0, 0xC0, 0x60, 0xE0, 0x1F, 0xFC, 0x07, 0xDE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @4386 'v'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0, 0xF8, 0xF8, 0x7C, 0x18, 0x18, 0x0C, 0x0C, 0x03, 0x0C, 0x01, 0x86, 0x00, 0x66, 0x00, 0x33, 0x00, 0x1F, 0x80, 0x07, 0x80, 0x03, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @4437 'w'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE0, 0xF0, 0xF0, 0x78, 0x31, 0x18, 0x19, 0xCC, 0x0C, 0xE6, 0x03, 0x56, 0x01, 0xEF, 0x00, 0xF7, 0x80, 0x71, 0x80, 0x18, 0xC0, 0x0C, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @4488 'x'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xF0, 0x7C, 0xF8, 0x0C, 0x30, 0x03, 0x30, 0x00, 0xF0, 0x00, 0x30, 0x00, 0x3C, 0x00, 0x33, 0x00, 0x30, 0xC0, 0x7C, 0xF8, 0x3E, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @4539 'y'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x7C, 0xFC, 0x3E, 0x18, 0x0C, 0x06, 0x0C, 0x03, 0x06, 0x00, 0xC6, 0x00, 0x63, 0x00, 0x1B, 0x00, 0x0F, 0x80, 0x03, 0x80, 0x00, 0xC0, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x60, 0x03, 0xFC, 0x01, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @4590 'z'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xE0, 0x3F, 0xF0, 0x18, 0x30, 0x0C, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0x00, 0x30, 0xC0, 0x30, 0x60, 0x3F, 0xF0, 0x1F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @4641 '{'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x3C, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x03, 0x00, 0x01, 0x80, 0x00, 0xC0, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x38, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x03, 0x00, 0x01, 0x80, 0x00, 0xC0, 0x00, 0x78, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @4692 '|'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x03, 0x00, 0x01, 0x80, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x03, 0x00, 0x01, 0x80, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @4743 '}'
+	0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0xF0, 0x00, 0x18, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x03, 0x00, 0x01, 0x80, 0x00, 0xC0, 0x00, 0x70, 0x00, 0x1C, 0x00, 0x1C, 0x00, 0x0C, 0x00, 0x06, 0x00, 0x03, 0x00, 0x01, 0x80, 0x00, 0xC0, 0x01, 0xE0, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @4794 '~'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x0F, 0x8C, 0x0E, 0xEE, 0x06, 0x3E, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+sFONT Font24P = {
+  Font24P_Table,
+  17, /* Width */
+  24, /* Height */
+  FONT_FORMAT_PACKED,
+};
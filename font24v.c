@@ -0,0 +1,229 @@
+/* Proportional Font24V generated by tools/fontprop.py from font24.c, do not edit.
+   24 rows, advances 3..18 pixels. */
+
+#include "fonts.h"
+
+const uint8_t Font24V_Table[] PROGMEM = 
+{
+	// @0 ' ' (9 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @27 '!' (4 pixels wide)
+	0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xE4, 0x40, 0x0E, 0xE0, 0x00, 0x00, 0x00,
+	// @39 '"' (9 pixels wide)
+	0x00, 0x00, 0x00, 0x1C, 0xEE, 0x77, 0x39, 0x08, 0x84, 0x42, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @66 '#' (12 pixels wide)
+	0x00, 0x00, 0x00, 0x19, 0x81, 0x98, 0x19, 0x81, 0x98, 0x19, 0x8F, 0xFE, 0xFF, 0xE1, 0x98, 0x33, 0x0F, 0xFE, 0xFF, 0xE3, 0x30, 0x33, 0x03, 0x30, 0x33, 0x03, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @102 '$' (10 pixels wide)
+	0x00, 0x03, 0x00, 0xC0, 0xF6, 0x7F, 0xB0, 0xEC, 0x3B, 0x80, 0x7C, 0x0F, 0xC0, 0x7B, 0x06, 0xE1, 0xB8, 0xEF, 0xF3, 0x78, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @132 '%' (11 pixels wide)
+	0x00, 0x00, 0x00, 0xF0, 0x3F, 0x0E, 0x71, 0x86, 0x30, 0xC7, 0x38, 0x7F, 0xC7, 0xE3, 0xFE, 0x1C, 0xE3, 0x0C, 0x61, 0x8E, 0x70, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @165 '&' (12 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x83, 0xF8, 0x63, 0x06, 0x00, 0x60, 0x03, 0x00, 0x38, 0x07, 0xCE, 0xEF, 0xEC, 0x78, 0xC3, 0x87, 0xFE, 0x3E, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @201 ''' (4 pixels wide)
+	0x00, 0x0E, 0xEE, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @213 '(' (7 pixels wide)
+	0x00, 0x00, 0x30, 0xE3, 0x8F, 0x1C, 0x38, 0xE1, 0xC3, 0x87, 0x0E, 0x1C, 0x1C, 0x38, 0x38, 0x70, 0x70, 0x60, 0x00, 0x00, 0x00,
+	// @234 ')' (7 pixels wide)
+	0x00, 0x03, 0x07, 0x07, 0x0E, 0x0E, 0x1C, 0x1C, 0x38, 0x70, 0xE1, 0xC3, 0x8E, 0x1C, 0x78, 0xE3, 0x86, 0x00, 0x00, 0x00, 0x00,
+	// @255 '*' (11 pixels wide)
+	0x00, 0x00, 0x00, 0x30, 0x06, 0x00, 0xC1, 0xDB, 0xBF, 0xF1, 0xF8, 0x1E, 0x03, 0xC0, 0xCC, 0x19, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @288 '+' (13 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x03, 0x00, 0x18, 0x00, 0xC0, 0x06, 0x07, 0xFF, 0xBF, 0xFC, 0x0C, 0x00, 0x60, 0x03, 0x00, 0x18, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @327 ',' (6 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x8C, 0x71, 0x86, 0x30, 0xC0, 0x00, 0x00,
+	// @345 '-' (11 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFB, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @378 '.' (5 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xDE, 0xF0, 0x00, 0x00, 0x00, 0x00,
+	// @393 '/' (11 pixels wide)
+	0x00, 0xC0, 0x18, 0x07, 0x00, 0xC0, 0x38, 0x06, 0x00, 0xC0, 0x30, 0x06, 0x01, 0x80, 0x30, 0x0C, 0x01, 0x80, 0x60, 0x0C, 0x03, 0x80, 0x60, 0x1C, 0x03, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @426 '0' (11 pixels wide)
+	0x00, 0x00, 0x00, 0x78, 0x1F, 0x86, 0x18, 0xC3, 0x30, 0x36, 0x06, 0xC0, 0xD8, 0x1B, 0x03, 0x60, 0x6C, 0x0C, 0xC3, 0x18, 0x61, 0xF8, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @459 '1' (11 pixels wide)
+	0x00, 0x00, 0x00, 0x10, 0x1E, 0x0F, 0xC1, 0xD8, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x07, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @492 '2' (12 pixels wide)
+	0x00, 0x00, 0x00, 0x1F, 0x07, 0xFC, 0xE0, 0xCC, 0x06, 0xC0, 0x60, 0x06, 0x00, 0xC0, 0x18, 0x07, 0x00, 0xE0, 0x18, 0x03, 0x00, 0x60, 0x0F, 0xFE, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @528 '3' (11 pixels wide)
+	0x00, 0x00, 0x00, 0x78, 0x3F, 0x86, 0x38, 0x03, 0x00, 0x60, 0x18, 0x1E, 0x03, 0xE0, 0x0E, 0x00, 0x60, 0x0C, 0x01, 0xB0, 0x77, 0xFC, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @561 '4' (12 pixels wide)
+	0x00, 0x00, 0x00, 0x03, 0x80, 0x78, 0x07, 0x80, 0xD8, 0x19, 0x81, 0x98, 0x31, 0x83, 0x18, 0x61, 0x8C, 0x18, 0xFF, 0xEF, 0xFE, 0x01, 0x80, 0xFE, 0x0F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @597 '5' (12 pixels wide)
+	0x00, 0x00, 0x00, 0x7F, 0xC7, 0xFC, 0x60, 0x06, 0x00, 0x60, 0x06, 0xF0, 0x7F, 0xC7, 0x0C, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0xC0, 0xCF, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @633 '6' (11 pixels wide)
+	0x00, 0x00, 0x00, 0x1F, 0x0F, 0xE3, 0x80, 0xE0, 0x18, 0x06, 0x00, 0xDE, 0x1F, 0xF3, 0x86, 0x60, 0x6C, 0x0D, 0x81, 0x98, 0x73, 0xFC, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @666 '7' (11 pixels wide)
+	0x00, 0x00, 0x03, 0xFF, 0x7F, 0xEC, 0x0D, 0x83, 0x80, 0x60, 0x0C, 0x03, 0x80, 0x60, 0x0C, 0x03, 0x80, 0x60, 0x0C, 0x03, 0x80, 0x60, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @699 '8' (11 pixels wide)
+	0x00, 0x00, 0x00, 0xFC, 0x3F, 0xCE, 0x1D, 0x81, 0xB0, 0x33, 0x0C, 0x3F, 0x07, 0xE1, 0x86, 0x60, 0x6C, 0x0D, 0x81, 0xB8, 0x73, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @732 '9' (11 pixels wide)
+	0x00, 0x00, 0x00, 0xF8, 0x3F, 0xCE, 0x19, 0x81, 0xB0, 0x36, 0x06, 0x61, 0xCF, 0xF8, 0x7B, 0x00, 0x60, 0x18, 0x07, 0x01, 0xC7, 0xF0, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @765 ':' (5 pixels wide)
+	0x00, 0x00, 0x00, 0x03, 0xDE, 0xF0, 0x00, 0x00, 0x03, 0xDE, 0xF0, 0x00, 0x00, 0x00, 0x00,
+	// @780 ';' (7 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x1E, 0x3C, 0x00, 0x00, 0x00, 0x07, 0x1C, 0x30, 0x61, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @801 '<' (15 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @846 '=' (14 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFE, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @888 '>' (15 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0xF0, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @933 '?' (10 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0xF8, 0x7F, 0x30, 0xEC, 0x1B, 0x06, 0x03, 0x81, 0xC1, 0xE0, 0x70, 0x18, 0x00, 0x00, 0x00, 0xE0, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @963 '@' (11 pixels wide)
+	0x00, 0x00, 0x00, 0x7C, 0x1F, 0xC7, 0x1C, 0xC1, 0xB0, 0xF6, 0x3E, 0xCE, 0xD9, 0x9B, 0x33, 0x66, 0x6C, 0x7D, 0x87, 0xB0, 0x03, 0x00, 0x70, 0xC7, 0xF8, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @996 'A' (17 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x01, 0xFC, 0x00, 0x0E, 0x00, 0x0D, 0x80, 0x06, 0xC0, 0x06, 0x30, 0x03, 0x18, 0x03, 0x0C, 0x01, 0xFF, 0x01, 0xFF, 0x80, 0xC0, 0x60, 0xC0, 0x31, 0xF8, 0xFE, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1047 'B' (14 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF0, 0xFF, 0xE0, 0xC1, 0xC3, 0x03, 0x0C, 0x0C, 0x30, 0x70, 0xFF, 0x83, 0xFF, 0x0C, 0x0E, 0x30, 0x18, 0xC0, 0x63, 0x01, 0xBF, 0xFC, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1089 'C' (13 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x63, 0xFF, 0x38, 0x39, 0x80, 0xD8, 0x06, 0xC0, 0x06, 0x00, 0x30, 0x01, 0x80, 0x0C, 0x00, 0x30, 0x19, 0xC1, 0xC7, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1128 'D' (14 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xE0, 0xFF, 0xE0, 0xC1, 0xC3, 0x03, 0x0C, 0x06, 0x30, 0x18, 0xC0, 0x63, 0x01, 0x8C, 0x06, 0x30, 0x18, 0xC0, 0xC3, 0x07, 0x3F, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1170 'E' (13 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xEF, 0xFF, 0x18, 0x18, 0xC0, 0xC6, 0x66, 0x33, 0x01, 0xF8, 0x0F, 0xC0, 0x66, 0x03, 0x33, 0x18, 0x18, 0xC0, 0xDF, 0xFE, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1209 'F' (13 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xEF, 0xFF, 0x18, 0x18, 0xC0, 0xC6, 0x66, 0x33, 0x01, 0xF8, 0x0F, 0xC0, 0x66, 0x03, 0x30, 0x18, 0x00, 0xC0, 0x1F, 0xE0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1248 'G' (14 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xEC, 0x3F, 0xF1, 0xC1, 0xC6, 0x03, 0x30, 0x0C, 0xC0, 0x03, 0x00, 0x0C, 0x3F, 0xB0, 0xFE, 0xC0, 0x33, 0x80, 0xC7, 0x07, 0x0F, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1290 'H' (15 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE7, 0xEF, 0xCF, 0xC6, 0x06, 0x0C, 0x0C, 0x18, 0x18, 0x30, 0x30, 0x7F, 0xE0, 0xFF, 0xC1, 0x81, 0x83, 0x03, 0x06, 0x06, 0x0C, 0x0C, 0x7E, 0x7E, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1335 'I' (11 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x7F, 0xEF, 0xFC, 0x18, 0x03, 0x00, 0x60, 0x0C, 0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x07, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1368 'J' (14 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x1F, 0xF8, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0x0C, 0x18, 0x3F, 0xE0, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1410 'K' (16 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x7C, 0xFE, 0x7C, 0x30, 0x60, 0x30, 0xC0, 0x31, 0x80, 0x33, 0x00, 0x37, 0x00, 0x3F, 0x80, 0x39, 0xC0, 0x30, 0xE0, 0x30, 0x60, 0x30, 0x70, 0xFE, 0x3E, 0xFE, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1458 'L' (14 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0xFF, 0x00, 0x60, 0x01, 0x80, 0x06, 0x00, 0x18, 0x00, 0x60, 0x01, 0x80, 0x06, 0x06, 0x18, 0x18, 0x60, 0x61, 0x81, 0xBF, 0xFE, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1500 'M' (17 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x01, 0xEF, 0x81, 0xF1, 0xC0, 0xE0, 0xF0, 0xF0, 0x78, 0x78, 0x36, 0x6C, 0x1B, 0x36, 0x0C, 0xF3, 0x06, 0x79, 0x83, 0x18, 0xC1, 0x80, 0x60, 0xC0, 0x31, 0xFC, 0xFE, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1551 'N' (15 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x8F, 0xEF, 0x1F, 0xC7, 0x06, 0x0F, 0x0C, 0x1F, 0x18, 0x36, 0x30, 0x6E, 0x60, 0xCE, 0xC1, 0x8D, 0x83, 0x1F, 0x06, 0x1E, 0x0C, 0x1C, 0x7F, 0x18, 0xFE, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1596 'O' (13 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x03, 0xFC, 0x38, 0x71, 0x81, 0x9C, 0x0E, 0xC0, 0x36, 0x01, 0xB0, 0x0D, 0x80, 0x6E, 0x07, 0x30, 0x31, 0xC3, 0x87, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1635 'P' (13 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x8F, 0xFE, 0x18, 0x38, 0xC0, 0xC6, 0x06, 0x30, 0x31, 0x83, 0x0F, 0xF8, 0x7F, 0x03, 0x00, 0x18, 0x00, 0xC0, 0x1F, 0xE0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1674 'Q' (13 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x03, 0xFC, 0x38, 0x71, 0x81, 0x9C, 0x0E, 0xC0, 0x36, 0x01, 0xB0, 0x0D, 0x80, 0x6E, 0x07, 0x30, 0x31, 0xC3, 0x87, 0xF8, 0x1F, 0x00, 0xF9, 0x8F, 0xFC, 0x61, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1713 'R' (15 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x0F, 0xFE, 0x06, 0x0E, 0x0C, 0x0C, 0x18, 0x18, 0x30, 0x70, 0x7F, 0xC0, 0xFE, 0x01, 0x8E, 0x03, 0x0E, 0x06, 0x0C, 0x0C, 0x1C, 0x7F, 0x1E, 0xFE, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1758 'S' (11 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x1F, 0x67, 0xFD, 0xC3, 0xB0, 0x36, 0x06, 0xF0, 0x0F, 0xC0, 0x7E, 0x01, 0xEC, 0x0D, 0x81, 0xB8, 0x77, 0xFC, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1791 'T' (13 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xEF, 0xFF, 0x63, 0x1B, 0x18, 0xD8, 0xC6, 0xC6, 0x30, 0x30, 0x01, 0x80, 0x0C, 0x00, 0x60, 0x03, 0x00, 0x18, 0x07, 0xF8, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1830 'U' (15 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE7, 0xEF, 0xCF, 0xC6, 0x06, 0x0C, 0x0C, 0x18, 0x18, 0x30, 0x30, 0x60, 0x60, 0xC0, 0xC1, 0x81, 0x83, 0x03, 0x06, 0x06, 0x06, 0x18, 0x0F, 0xF0, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1875 'V' (16 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFE, 0xFE, 0xFE, 0x30, 0x18, 0x18, 0x30, 0x18, 0x30, 0x18, 0x30, 0x0C, 0x60, 0x0C, 0x60, 0x06, 0xC0, 0x06, 0xC0, 0x06, 0xC0, 0x03, 0x80, 0x03, 0x80, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1923 'W' (18 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF8, 0xFE, 0xFE, 0x3F, 0x8C, 0x01, 0x83, 0x00, 0x60, 0xC2, 0x18, 0x19, 0xCC, 0x06, 0x73, 0x01, 0xB6, 0xC0, 0x6D, 0xB0, 0x1E, 0x7C, 0x03, 0x8E, 0x00, 0xE3, 0x80, 0x30, 0x60, 0x0C, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @1977 'X' (15 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE7, 0xEF, 0xCF, 0xC6, 0x06, 0x06, 0x18, 0x06, 0x60, 0x07, 0x80, 0x06, 0x00, 0x0C, 0x00, 0x3C, 0x00, 0xCC, 0x03, 0x0C, 0x0C, 0x0C, 0x7E, 0x7E, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2022 'Y' (15 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC7, 0xEF, 0x8F, 0xC6, 0x06, 0x06, 0x18, 0x06, 0x60, 0x0C, 0xC0, 0x0F, 0x00, 0x0C, 0x00, 0x18, 0x00, 0x30, 0x00, 0x60, 0x00, 0xC0, 0x0F, 0xF0, 0x1F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2067 'Z' (12 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x07, 0xFE, 0x7F, 0xE6, 0x06, 0x60, 0xC6, 0x18, 0x63, 0x00, 0x60, 0x0C, 0x01, 0x86, 0x30, 0x66, 0x06, 0xC0, 0x6F, 0xFE, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2103 '[' (6 pixels wide)
+	0x00, 0x0F, 0xBE, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0F, 0xBE, 0x00, 0x00, 0x00,
+	// @2121 '\' (11 pixels wide)
+	0xC0, 0x18, 0x03, 0x80, 0x30, 0x07, 0x00, 0x60, 0x0C, 0x00, 0xC0, 0x18, 0x01, 0x80, 0x30, 0x03, 0x00, 0x60, 0x06, 0x00, 0xC0, 0x1C, 0x01, 0x80, 0x38, 0x03, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2154 ']' (6 pixels wide)
+	0x00, 0x0F, 0xBE, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x18, 0x61, 0x86, 0x18, 0x6F, 0xBE, 0x00, 0x00, 0x00,
+	// @2172 '^' (12 pixels wide)
+	0x00, 0x00, 0x40, 0x0E, 0x01, 0xF0, 0x3B, 0x83, 0x18, 0x60, 0xCC, 0x06, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2208 '_' (17 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFD, 0xFF, 0xFE,
+	// @2259 '`' (6 pixels wide)
+	0x03, 0x0E, 0x0E, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2277 'a' (13 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0xF0, 0x00, 0xC0, 0x06, 0x07, 0xF0, 0xFF, 0x8E, 0x0C, 0x60, 0x63, 0x07, 0x0F, 0xFE, 0x3E, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2316 'b' (14 pixels wide)
+	0x00, 0x00, 0x00, 0x0F, 0x00, 0x3C, 0x00, 0x30, 0x00, 0xC0, 0x03, 0x7C, 0x0F, 0xFC, 0x38, 0x30, 0xC0, 0x63, 0x01, 0x8C, 0x06, 0x30, 0x18, 0xC0, 0x63, 0x83, 0x3F, 0xFC, 0xF7, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2358 'c' (13 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0xC7, 0xFE, 0x70, 0x77, 0x01, 0xB0, 0x0D, 0x80, 0x0C, 0x00, 0x70, 0x19, 0xC1, 0xC7, 0xFC, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2397 'd' (14 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x78, 0x00, 0x60, 0x01, 0x81, 0xF6, 0x1F, 0xF8, 0x60, 0xE3, 0x01, 0x8C, 0x06, 0x30, 0x18, 0xC0, 0x63, 0x01, 0x86, 0x0E, 0x1F, 0xFE, 0x1F, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2439 'e' (13 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x0F, 0xFC, 0x60, 0x66, 0x01, 0xBF, 0xFD, 0xFF, 0xEC, 0x00, 0x60, 0x01, 0x80, 0xCF, 0xFE, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2478 'f' (13 pixels wide)
+	0x00, 0x00, 0x00, 0x01, 0xFC, 0x1F, 0xE1, 0x80, 0x0C, 0x03, 0xFF, 0x9F, 0xFC, 0x18, 0x00, 0xC0, 0x06, 0x00, 0x30, 0x01, 0x80, 0x0C, 0x00, 0x60, 0x1F, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2517 'g' (14 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF7, 0x9F, 0xFE, 0x60, 0xE3, 0x01, 0x8C, 0x06, 0x30, 0x18, 0xC0, 0x63, 0x01, 0x86, 0x0E, 0x1F, 0xF8, 0x1F, 0x60, 0x01, 0x80, 0x06, 0x00, 0x38, 0x3F, 0xC0, 0xFC, 0x00, 0x00, 0x00, 0x00,
+	// @2559 'h' (15 pixels wide)
+	0x00, 0x00, 0x00, 0x03, 0xC0, 0x07, 0x80, 0x03, 0x00, 0x06, 0x00, 0x0D, 0xF0, 0x1F, 0xF0, 0x38, 0x70, 0x60, 0x60, 0xC0, 0xC1, 0x81, 0x83, 0x03, 0x06, 0x06, 0x0C, 0x0C, 0x7E, 0x7E, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2604 'i' (13 pixels wide)
+	0x00, 0x00, 0x00, 0x01, 0x80, 0x0C, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x0F, 0xC0, 0x06, 0x00, 0x30, 0x01, 0x80, 0x0C, 0x00, 0x60, 0x03, 0x00, 0x18, 0x1F, 0xFE, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2643 'j' (10 pixels wide)
+	0x00, 0x00, 0x00, 0x60, 0x18, 0x00, 0x00, 0x0F, 0xFB, 0xFE, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x06, 0x01, 0x80, 0x60, 0x18, 0x0E, 0xFF, 0x3F, 0x00, 0x00, 0x00,
+	// @2673 'k' (13 pixels wide)
+	0x00, 0x00, 0x00, 0x3C, 0x01, 0xE0, 0x03, 0x00, 0x18, 0x00, 0xCF, 0x86, 0x7C, 0x33, 0x01, 0xB0, 0x0F, 0x80, 0x78, 0x03, 0xE0, 0x1B, 0x80, 0xCE, 0x1E, 0x3E, 0xF1, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2712 'l' (13 pixels wide)
+	0x00, 0x00, 0x00, 0x1F, 0x80, 0xFC, 0x00, 0x60, 0x03, 0x00, 0x18, 0x00, 0xC0, 0x06, 0x00, 0x30, 0x01, 0x80, 0x0C, 0x00, 0x60, 0x03, 0x00, 0x18, 0x1F, 0xFE, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2751 'm' (17 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xDD, 0xE1, 0xFF, 0xF8, 0x39, 0xCC, 0x18, 0xC6, 0x0C, 0x63, 0x06, 0x31, 0x83, 0x18, 0xC1, 0x8C, 0x60, 0xC6, 0x31, 0xFB, 0xDE, 0xFD, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2802 'n' (15 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3D, 0xF0, 0x7F, 0xF0, 0x38, 0x70, 0x60, 0x60, 0xC0, 0xC1, 0x81, 0x83, 0x03, 0x06, 0x06, 0x0C, 0x0C, 0x7E, 0x7E, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2847 'o' (13 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x07, 0xF8, 0x70, 0xE7, 0x03, 0xB0, 0x0D, 0x80, 0x6C, 0x03, 0x70, 0x39, 0xC3, 0x87, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @2886 'p' (14 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x7C, 0x3F, 0xFC, 0x38, 0x30, 0xC0, 0x63, 0x01, 0x8C, 0x06, 0x30, 0x18, 0xC0, 0x63, 0x83, 0x0F, 0xFC, 0x37, 0xC0, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0xFE, 0x03, 0xF8, 0x00, 0x00, 0x00, 0x00,
+	// @2928 'q' (14 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF7, 0x9F, 0xFE, 0x60, 0xE3, 0x01, 0x8C, 0x06, 0x30, 0x18, 0xC0, 0x63, 0x01, 0x86, 0x0E, 0x1F, 0xF8, 0x1F, 0x60, 0x01, 0x80, 0x06, 0x00, 0x18, 0x03, 0xF8, 0x0F, 0xE0, 0x00, 0x00, 0x00,
+	// @2970 'r' (13 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE7, 0x9F, 0x7E, 0x1F, 0x30, 0xE0, 0x06, 0x00, 0x30, 0x01, 0x80, 0x0C, 0x00, 0x60, 0x1F, 0xF8, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @3009 's' (11 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xF3, 0xFE, 0xC0, 0xD8, 0x1B, 0xF0, 0x3F, 0xC0, 0x7D, 0x81, 0xB0, 0x77, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @3042 't' (13 pixels wide)
+	0x00, 0x00, 0x00, 0x0C, 0x00, 0x60, 0x03, 0x00, 0x18, 0x03, 0xFF, 0x1F, 0xF8, 0x30, 0x01, 0x80, 0x0C, 0x00, 0x60, 0x03, 0x00, 0x18, 0x00, 0xC1, 0xC3, 0xFE, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @3081 'u' (15 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x3C, 0x78, 0x78, 0x30, 0x30, 0x60, 0x60, 0xC0, 0xC1, 0x81, 0x83, 0x03, 0x06, 0x06, 0x0C, 0x1C, 0x0F, 0xFE, 0x0F, 0xBC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @3126 'v' (15 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x1F, 0x7C, 0x3E, 0x30, 0x30, 0x60, 0x60, 0x61, 0x80, 0xC3, 0x00, 0xCC, 0x01, 0x98, 0x03, 0xF0, 0x03, 0xC0, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @3171 'w' (14 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x07, 0xBC, 0x1E, 0x62, 0x31, 0x9C, 0xC6, 0x73, 0x0D, 0x58, 0x3D, 0xE0, 0xF7, 0x83, 0x8C, 0x06, 0x30, 0x18, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @3213 'x' (13 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE7, 0xDF, 0x3E, 0x30, 0xC0, 0xCC, 0x03, 0xC0, 0x0C, 0x00, 0xF0, 0x0C, 0xC0, 0xC3, 0x1F, 0x3E, 0xF9, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @3252 'y' (16 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x3E, 0xFC, 0x3E, 0x30, 0x18, 0x18, 0x30, 0x18, 0x30, 0x0C, 0x60, 0x0C, 0x60, 0x06, 0xC0, 0x07, 0xC0, 0x03, 0x80, 0x01, 0x80, 0x03, 0x00, 0x03, 0x00, 0x06, 0x00, 0x7F, 0x80, 0x7F, 0x80, 0x00, 0x00, 0x00, 0x00,
+	// @3300 'z' (11 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xF7, 0xFE, 0xC1, 0x98, 0x60, 0x18, 0x06, 0x01, 0x80, 0x61, 0x98, 0x37, 0xFE, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	// @3333 '{' (7 pixels wide)
+	0x00, 0x00, 0x71, 0xE3, 0x06, 0x0C, 0x18, 0x30, 0x61, 0xC7, 0x07, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xF0, 0xE0, 0x00, 0x00, 0x00,
+	// @3354 '|' (3 pixels wide)
+	0x03, 0x6D, 0xB6, 0xDB, 0x6D, 0xB6, 0xDB, 0x60, 0x00,
+	// @3363 '}' (7 pixels wide)
+	0x00, 0x03, 0x87, 0x83, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xE0, 0xE3, 0x86, 0x0C, 0x18, 0x30, 0x63, 0xC7, 0x00, 0x00, 0x00, 0x00,
+	// @3384 '~' (12 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x07, 0xC6, 0xEE, 0xEC, 0x7C, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+const uint8_t Font24V_Widths[] PROGMEM = 
+{
+	9, 4, 9, 12, 10, 11, 12, 4, 7, 7, 11, 13, 6, 11, 5, 11,
+	11, 11, 12, 11, 12, 12, 11, 11, 11, 11, 5, 7, 15, 14, 15, 10,
+	11, 17, 14, 13, 14, 13, 13, 14, 15, 11, 14, 16, 14, 17, 15, 13,
+	13, 13, 15, 11, 13, 15, 16, 18, 15, 15, 12, 6, 11, 6, 12, 17,
+	6, 13, 14, 13, 14, 13, 13, 14, 15, 13, 10, 13, 13, 17, 15, 13,
+	14, 14, 13, 11, 13, 15, 15, 14, 13, 16, 11, 7, 3, 7, 12,
+};
+
+const uint16_t Font24V_Offsets[] PROGMEM = 
+{
+	0, 27, 39, 66, 102, 132, 165, 201, 213, 234, 255, 288,
+	327, 345, 378, 393, 426, 459, 492, 528, 561, 597, 633, 666,
+	699, 732, 765, 780, 801, 846, 888, 933, 963, 996, 1047, 1089,
+	1128, 1170, 1209, 1248, 1290, 1335, 1368, 1410, 1458, 1500, 1551, 1596,
+	1635, 1674, 1713, 1758, 1791, 1830, 1875, 1923, 1977, 2022, 2067, 2103,
+	2121, 2154, 2172, 2208, 2259, 2277, 2316, 2358, 2397, 2439, 2478, 2517,
+	2559, 2604, 2643, 2673, 2712, 2751, 2802, 2847, 2886, 2928, 2970, 3009,
+	3042, 3081, 3126, 3171, 3213, 3252, 3300, 3333, 3354, 3363, 3384,
+};
+
+sFONT Font24V = {
+  Font24V_Table,
+  12, /* Width: mean advance */
+  24, /* Height */
+  FONT_FORMAT_PROP,
+  Font24V_Widths,
+  Font24V_Offsets,
+};
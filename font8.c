@@ -37,7 +37,6 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include "fonts.h"
-#include <avr/pgmspace.h>
 
 // 
 //  Font data for Courier New 12pt
@@ -0,0 +1,205 @@
+/* Packed Font8 generated by tools/fontpack.py from font8.c, do not edit.
+   5 x 8 glyphs, 5 bytes per glyph. */
+
+#include "fonts.h"
+
+const uint8_t Font8P_Table[] PROGMEM = 
+{
+	// @0 ' '
+	0x00, 0x00, 0x00, 0x00, 0x00,
+	// @5 '!'
+	0x21, 0x08, 0x40, 0x10, 0x00,
+	// @10 '"'
+	0x52, 0x80, 0x00, 0x00, 0x00,
+	// @15 '#'
+	0x2A, 0xBE, 0xAF, 0xAA, 0x80,
+	// @20 '$'
+	0x21, 0x98, 0x61, 0x30, 0x80,
+	// @25 '%'
+	0x21, 0x06, 0xC1, 0x08, 0x00,
+	// @30 '&'
+	0x01, 0xC8, 0xC5, 0x3C, 0x00,
+	// @35 '''
+	0x21, 0x08, 0x00, 0x00, 0x00,
+	// @40 '('
+	0x11, 0x08, 0x42, 0x10, 0x40,
+	// @45 ')'
+	0x41, 0x08, 0x42, 0x11, 0x00,
+	// @50 '*'
+	0x23, 0x88, 0xA0, 0x00, 0x00,
+	// @55 '+'
+	0x01, 0x09, 0xF2, 0x10, 0x00,
+	// @60 ','
+	0x00, 0x00, 0x01, 0x10, 0x80,
+	// @65 '-'
+	0x00, 0x00, 0xE0, 0x00, 0x00,
+	// @70 '.'
+	0x00, 0x00, 0x00, 0x10, 0x00,
+	// @75 '/'
+	0x11, 0x08, 0x44, 0x22, 0x00,
+	// @80 '0'
+	0x22, 0x94, 0xA5, 0x10, 0x00,
+	// @85 '1'
+	0x61, 0x08, 0x42, 0x7C, 0x00,
+	// @90 '2'
+	0x22, 0x88, 0x44, 0x38, 0x00,
+	// @95 '3'
+	0x22, 0x84, 0x41, 0x30, 0x00,
+	// @100 '4'
+	0x11, 0x94, 0xF1, 0x1C, 0x00,
+	// @105 '5'
+	0x72, 0x18, 0x25, 0x10, 0x00,
+	// @110 '6'
+	0x32, 0x18, 0xA5, 0x30, 0x00,
+	// @115 '7'
+	0x72, 0x84, 0x42, 0x10, 0x00,
+	// @120 '8'
+	0x22, 0x88, 0xA5, 0x10, 0x00,
+	// @125 '9'
+	0x32, 0x94, 0x61, 0x30, 0x00,
+	// @130 ':'
+	0x00, 0x08, 0x00, 0x10, 0x00,
+	// @135 ';'
+	0x00, 0x04, 0x01, 0x10, 0x00,
+	// @140 '<'
+	0x00, 0x89, 0x82, 0x08, 0x00,
+	// @145 '='
+	0x03, 0x80, 0xE0, 0x00, 0x00,
+	// @150 '>'
+	0x02, 0x08, 0x32, 0x20, 0x00,
+	// @155 '?'
+	0x22, 0x84, 0x40, 0x10, 0x00,
+	// @160 '@'
+	0x32, 0x52, 0xB4, 0xA0, 0xE0,
+	// @165 'A'
+	0x61, 0x14, 0xE8, 0xEC, 0x00,
+	// @170 'B'
+	0xF2, 0x5C, 0x94, 0xF8, 0x00,
+	// @175 'C'
+	0x72, 0x90, 0x84, 0x18, 0x00,
+	// @180 'D'
+	0xF2, 0x52, 0x94, 0xF8, 0x00,
+	// @185 'E'
+	0xFA, 0x58, 0x84, 0xFC, 0x00,
+	// @190 'F'
+	0xFA, 0x58, 0x84, 0x70, 0x00,
+	// @195 'G'
+	0x72, 0x10, 0xB5, 0x18, 0x00,
+	// @200 'H'
+	0xEA, 0x5E, 0x94, 0xF4, 0x00,
+	// @205 'I'
+	0x71, 0x08, 0x42, 0x38, 0x00,
+	// @210 'J'
+	0x38, 0x84, 0xA5, 0x10, 0x00,
+	// @215 'K'
+	0xDA, 0x98, 0xE5, 0x6C, 0x00,
+	// @220 'L'
+	0xE2, 0x10, 0x84, 0xFC, 0x00,
+	// @225 'M'
+	0xDE, 0xF7, 0x58, 0xEC, 0x00,
+	// @230 'N'
+	0xDB, 0x5A, 0xB5, 0xF4, 0x00,
+	// @235 'O'
+	0x32, 0x52, 0x94, 0x98, 0x00,
+	// @240 'P'
+	0xF2, 0x52, 0xE4, 0x70, 0x00,
+	// @245 'Q'
+	0x32, 0x52, 0x94, 0x98, 0x60,
+	// @250 'R'
+	0xF2, 0x52, 0xE4, 0xF4, 0x00,
+	// @255 'S'
+	0x72, 0x88, 0x25, 0x38, 0x00,
+	// @260 'T'
+	0xFD, 0x48, 0x42, 0x38, 0x00,
+	// @265 'U'
+	0xDA, 0x52, 0x94, 0x98, 0x00,
+	// @270 'V'
+	0xDC, 0x52, 0xA5, 0x18, 0x00,
+	// @275 'W'
+	0xDC, 0x6B, 0x5A, 0xA8, 0x00,
+	// @280 'X'
+	0xDA, 0x88, 0x45, 0x6C, 0x00,
+	// @285 'Y'
+	0xDC, 0x54, 0x42, 0x38, 0x00,
+	// @290 'Z'
+	0x7A, 0x44, 0x44, 0xBC, 0x00,
+	// @295 '['
+	0x31, 0x08, 0x42, 0x10, 0xC0,
+	// @300 '\'
+	0x82, 0x10, 0x42, 0x10, 0x40,
+	// @305 ']'
+	0x61, 0x08, 0x42, 0x11, 0x80,
+	// @310 '^'
+	0x21, 0x14, 0x00, 0x00, 0x00,
+	// @315 '_'
+	0x00, 0x00, 0x00, 0x00, 0x1F,
+	// @320 '`'
+	0x20, 0x80, 0x00, 0x00, 0x00,
+	// @325 'a'
+	0x00, 0x0C, 0x27, 0x3C, 0x00,
+	// @330 'b'
+	0xC2, 0x1C, 0x94, 0xF8, 0x00,
+	// @335 'c'
+	0x00, 0x1C, 0x84, 0x38, 0x00,
+	// @340 'd'
+	0x18, 0x4E, 0x94, 0x9C, 0x00,
+	// @345 'e'
+	0x00, 0x1C, 0xE4, 0x18, 0x00,
+	// @350 'f'
+	0x11, 0x1C, 0x42, 0x38, 0x00,
+	// @355 'g'
+	0x00, 0x0E, 0x94, 0x9C, 0x26,
+	// @360 'h'
+	0xC2, 0x1C, 0x94, 0xF4, 0x00,
+	// @365 'i'
+	0x20, 0x18, 0x42, 0x38, 0x00,
+	// @370 'j'
+	0x20, 0x1C, 0x21, 0x08, 0x4E,
+	// @375 'k'
+	0xC2, 0x16, 0xE5, 0x6C, 0x00,
+	// @380 'l'
+	0x61, 0x08, 0x42, 0x38, 0x00,
+	// @385 'm'
+	0x00, 0x35, 0x5A, 0xD4, 0x00,
+	// @390 'n'
+	0x00, 0x3C, 0x94, 0xE4, 0x00,
+	// @395 'o'
+	0x00, 0x0C, 0x94, 0x98, 0x00,
+	// @400 'p'
+	0x00, 0x3C, 0x94, 0xB9, 0x1C,
+	// @405 'q'
+	0x00, 0x0E, 0x94, 0x9C, 0x23,
+	// @410 'r'
+	0x00, 0x1E, 0x42, 0x38, 0x00,
+	// @415 's'
+	0x00, 0x0C, 0x41, 0x30, 0x00,
+	// @420 't'
+	0x02, 0x3C, 0x84, 0x98, 0x00,
+	// @425 'u'
+	0x00, 0x36, 0x94, 0x9C, 0x00,
+	// @430 'v'
+	0x00, 0x32, 0x93, 0x18, 0x00,
+	// @435 'w'
+	0x00, 0x37, 0x5A, 0xA8, 0x00,
+	// @440 'x'
+	0x00, 0x12, 0x63, 0x24, 0x00,
+	// @445 'y'
+	0x00, 0x36, 0xA5, 0x10, 0x8C,
+	// @450 'z'
+	0x00, 0x1E, 0xA2, 0xBC, 0x00,
+	// @455 '{'
+	0x11, 0x08, 0xC2, 0x10, 0x40,
+	// @460 '|'
+	0x21, 0x08, 0x42, 0x10, 0x80,
+	// @465 '}'
+	0x41, 0x08, 0x62, 0x11, 0x00,
+	// @470 '~'
+	0x00, 0x00, 0x55, 0x00, 0x00,
+};
+
+sFONT Font8P = {
+  Font8P_Table,
+  5, /* Width */
+  8, /* Height */
+  FONT_FORMAT_PACKED,
+};
@@ -0,0 +1,229 @@
+/* Proportional Font8V generated by tools/fontprop.py from font8.c, do not edit.
+   8 rows, advances 2..6 pixels. */
+
+#include "fonts.h"
+
+const uint8_t Font8V_Table[] PROGMEM = 
+{
+	// @0 ' ' (3 pixels wide)
+	0x00, 0x00, 0x00,
+	// @3 '!' (2 pixels wide)
+	0xAA, 0x20,
+	// @5 '"' (4 pixels wide)
+	0xAA, 0x00, 0x00, 0x00,
+	// @9 '#' (6 pixels wide)
+	0x29, 0x4F, 0x94, 0xF9, 0x4A, 0x00,
+	// @15 '$' (4 pixels wide)
+	0x46, 0xC6, 0x2C, 0x40,
+	// @19 '%' (5 pixels wide)
+	0x42, 0x0D, 0x82, 0x10, 0x00,
+	// @24 '&' (5 pixels wide)
+	0x03, 0x91, 0x8A, 0x78, 0x00,
+	// @29 ''' (2 pixels wide)
+	0xA8, 0x00,
+	// @31 '(' (3 pixels wide)
+	0x52, 0x49, 0x10,
+	// @34 ')' (3 pixels wide)
+	0x89, 0x24, 0xA0,
+	// @37 '*' (4 pixels wide)
+	0x4E, 0x4A, 0x00, 0x00,
+	// @41 '+' (6 pixels wide)
+	0x00, 0x82, 0x3E, 0x20, 0x80, 0x00,
+	// @47 ',' (3 pixels wide)
+	0x00, 0x05, 0x20,
+	// @50 '-' (4 pixels wide)
+	0x00, 0x0E, 0x00, 0x00,
+	// @54 '.' (2 pixels wide)
+	0x00, 0x20,
+	// @56 '/' (5 pixels wide)
+	0x11, 0x08, 0x44, 0x22, 0x00,
+	// @61 '0' (4 pixels wide)
+	0x4A, 0xAA, 0xA4, 0x00,
+	// @65 '1' (6 pixels wide)
+	0x60, 0x82, 0x08, 0x23, 0xE0, 0x00,
+	// @71 '2' (4 pixels wide)
+	0x4A, 0x44, 0x8E, 0x00,
+	// @75 '3' (4 pixels wide)
+	0x4A, 0x24, 0x2C, 0x00,
+	// @79 '4' (5 pixels wide)
+	0x23, 0x29, 0xE2, 0x38, 0x00,
+	// @84 '5' (4 pixels wide)
+	0xE8, 0xC2, 0xA4, 0x00,
+	// @88 '6' (4 pixels wide)
+	0x68, 0xCA, 0xAC, 0x00,
+	// @92 '7' (4 pixels wide)
+	0xEA, 0x24, 0x44, 0x00,
+	// @96 '8' (4 pixels wide)
+	0x4A, 0x4A, 0xA4, 0x00,
+	// @100 '9' (4 pixels wide)
+	0x6A, 0xA6, 0x2C, 0x00,
+	// @104 ':' (2 pixels wide)
+	0x08, 0x20,
+	// @106 ';' (3 pixels wide)
+	0x01, 0x05, 0x00,
+	// @109 '<' (5 pixels wide)
+	0x00, 0x89, 0x82, 0x08, 0x00,
+	// @114 '=' (4 pixels wide)
+	0x0E, 0x0E, 0x00, 0x00,
+	// @118 '>' (5 pixels wide)
+	0x04, 0x10, 0x64, 0x40, 0x00,
+	// @123 '?' (4 pixels wide)
+	0x4A, 0x24, 0x04, 0x00,
+	// @127 '@' (5 pixels wide)
+	0x64, 0xA5, 0x69, 0x41, 0xC0,
+	// @132 'A' (6 pixels wide)
+	0x60, 0x85, 0x1C, 0x8B, 0x60, 0x00,
+	// @138 'B' (6 pixels wide)
+	0xF1, 0x27, 0x12, 0x4B, 0xC0, 0x00,
+	// @144 'C' (4 pixels wide)
+	0xEA, 0x88, 0x86, 0x00,
+	// @148 'D' (6 pixels wide)
+	0xF1, 0x24, 0x92, 0x4B, 0xC0, 0x00,
+	// @154 'E' (6 pixels wide)
+	0xF9, 0x26, 0x10, 0x4B, 0xE0, 0x00,
+	// @160 'F' (6 pixels wide)
+	0xF9, 0x26, 0x10, 0x43, 0x80, 0x00,
+	// @166 'G' (5 pixels wide)
+	0xE4, 0x21, 0x6A, 0x30, 0x00,
+	// @171 'H' (6 pixels wide)
+	0xE9, 0x27, 0x92, 0x4B, 0xA0, 0x00,
+	// @177 'I' (4 pixels wide)
+	0xE4, 0x44, 0x4E, 0x00,
+	// @181 'J' (5 pixels wide)
+	0x71, 0x09, 0x4A, 0x20, 0x00,
+	// @186 'K' (6 pixels wide)
+	0xD9, 0x46, 0x1C, 0x53, 0x60, 0x00,
+	// @192 'L' (6 pixels wide)
+	0xE1, 0x04, 0x10, 0x4B, 0xE0, 0x00,
+	// @198 'M' (6 pixels wide)
+	0xDB, 0x6D, 0xAA, 0x8B, 0x60, 0x00,
+	// @204 'N' (6 pixels wide)
+	0xD9, 0xA6, 0x96, 0x5B, 0xA0, 0x00,
+	// @210 'O' (5 pixels wide)
+	0x64, 0xA5, 0x29, 0x30, 0x00,
+	// @215 'P' (6 pixels wide)
+	0xF1, 0x24, 0x9C, 0x43, 0x80, 0x00,
+	// @221 'Q' (5 pixels wide)
+	0x64, 0xA5, 0x29, 0x30, 0xC0,
+	// @226 'R' (6 pixels wide)
+	0xF1, 0x24, 0x9C, 0x4B, 0xA0, 0x00,
+	// @232 'S' (4 pixels wide)
+	0xEA, 0x42, 0xAE, 0x00,
+	// @236 'T' (6 pixels wide)
+	0xFA, 0xA2, 0x08, 0x21, 0xC0, 0x00,
+	// @242 'U' (6 pixels wide)
+	0xD9, 0x24, 0x92, 0x48, 0xC0, 0x00,
+	// @248 'V' (6 pixels wide)
+	0xDA, 0x24, 0x94, 0x50, 0xC0, 0x00,
+	// @254 'W' (6 pixels wide)
+	0xDA, 0x2A, 0xAA, 0xA9, 0x40, 0x00,
+	// @260 'X' (6 pixels wide)
+	0xD9, 0x42, 0x08, 0x53, 0x60, 0x00,
+	// @266 'Y' (6 pixels wide)
+	0xDA, 0x25, 0x08, 0x21, 0xC0, 0x00,
+	// @272 'Z' (5 pixels wide)
+	0xF4, 0x88, 0x89, 0x78, 0x00,
+	// @277 '[' (3 pixels wide)
+	0xD2, 0x49, 0x30,
+	// @280 '\' (5 pixels wide)
+	0x82, 0x10, 0x42, 0x10, 0x40,
+	// @285 ']' (3 pixels wide)
+	0xC9, 0x24, 0xB0,
+	// @288 '^' (4 pixels wide)
+	0x44, 0xA0, 0x00, 0x00,
+	// @292 '_' (6 pixels wide)
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x3E,
+	// @298 '`' (3 pixels wide)
+	0x88, 0x00, 0x00,
+	// @301 'a' (5 pixels wide)
+	0x00, 0x18, 0x4E, 0x78, 0x00,
+	// @306 'b' (6 pixels wide)
+	0xC1, 0x07, 0x12, 0x4B, 0xC0, 0x00,
+	// @312 'c' (4 pixels wide)
+	0x00, 0xE8, 0x8E, 0x00,
+	// @316 'd' (5 pixels wide)
+	0x30, 0x9D, 0x29, 0x38, 0x00,
+	// @321 'e' (4 pixels wide)
+	0x00, 0xEE, 0x86, 0x00,
+	// @325 'f' (4 pixels wide)
+	0x24, 0xE4, 0x4E, 0x00,
+	// @329 'g' (5 pixels wide)
+	0x00, 0x1D, 0x29, 0x38, 0x4C,
+	// @334 'h' (6 pixels wide)
+	0xC1, 0x07, 0x12, 0x4B, 0xA0, 0x00,
+	// @340 'i' (4 pixels wide)
+	0x40, 0xC4, 0x4E, 0x00,
+	// @344 'j' (4 pixels wide)
+	0x40, 0xE2, 0x22, 0x2E,
+	// @348 'k' (6 pixels wide)
+	0xC1, 0x05, 0x9C, 0x53, 0x60, 0x00,
+	// @354 'l' (4 pixels wide)
+	0xC4, 0x44, 0x4E, 0x00,
+	// @358 'm' (6 pixels wide)
+	0x00, 0x0D, 0x2A, 0xAA, 0xA0, 0x00,
+	// @364 'n' (6 pixels wide)
+	0x00, 0x0F, 0x12, 0x4B, 0x20, 0x00,
+	// @370 'o' (5 pixels wide)
+	0x00, 0x19, 0x29, 0x30, 0x00,
+	// @375 'p' (6 pixels wide)
+	0x00, 0x0F, 0x12, 0x49, 0xC4, 0x38,
+	// @381 'q' (5 pixels wide)
+	0x00, 0x1D, 0x29, 0x38, 0x46,
+	// @386 'r' (5 pixels wide)
+	0x00, 0x3C, 0x84, 0x70, 0x00,
+	// @391 's' (4 pixels wide)
+	0x00, 0x64, 0x2C, 0x00,
+	// @395 't' (6 pixels wide)
+	0x01, 0x0F, 0x10, 0x48, 0xC0, 0x00,
+	// @401 'u' (6 pixels wide)
+	0x00, 0x0D, 0x92, 0x48, 0xE0, 0x00,
+	// @407 'v' (6 pixels wide)
+	0x00, 0x0C, 0x92, 0x30, 0xC0, 0x00,
+	// @413 'w' (6 pixels wide)
+	0x00, 0x0D, 0xAA, 0xA9, 0x40, 0x00,
+	// @419 'x' (5 pixels wide)
+	0x00, 0x24, 0xC6, 0x48, 0x00,
+	// @424 'y' (6 pixels wide)
+	0x00, 0x0D, 0x94, 0x50, 0x82, 0x18,
+	// @430 'z' (5 pixels wide)
+	0x00, 0x3D, 0x45, 0x78, 0x00,
+	// @435 '{' (4 pixels wide)
+	0x24, 0x4C, 0x44, 0x20,
+	// @439 '|' (2 pixels wide)
+	0xAA, 0xA8,
+	// @441 '}' (4 pixels wide)
+	0x84, 0x46, 0x44, 0x80,
+	// @445 '~' (5 pixels wide)
+	0x00, 0x00, 0xAA, 0x00, 0x00,
+};
+
+const uint8_t Font8V_Widths[] PROGMEM = 
+{
+	3, 2, 4, 6, 4, 5, 5, 2, 3, 3, 4, 6, 3, 4, 2, 5,
+	4, 6, 4, 4, 5, 4, 4, 4, 4, 4, 2, 3, 5, 4, 5, 4,
+	5, 6, 6, 4, 6, 6, 6, 5, 6, 4, 5, 6, 6, 6, 6, 5,
+	6, 5, 6, 4, 6, 6, 6, 6, 6, 6, 5, 3, 5, 3, 4, 6,
+	3, 5, 6, 4, 5, 4, 4, 5, 6, 4, 4, 6, 4, 6, 6, 5,
+	6, 5, 5, 4, 6, 6, 6, 6, 5, 6, 5, 4, 2, 4, 5,
+};
+
+const uint16_t Font8V_Offsets[] PROGMEM = 
+{
+	0, 3, 5, 9, 15, 19, 24, 29, 31, 34, 37, 41,
+	47, 50, 54, 56, 61, 65, 71, 75, 79, 84, 88, 92,
+	96, 100, 104, 106, 109, 114, 118, 123, 127, 132, 138, 144,
+	148, 154, 160, 166, 171, 177, 181, 186, 192, 198, 204, 210,
+	215, 221, 226, 232, 236, 242, 248, 254, 260, 266, 272, 277,
+	280, 285, 288, 292, 298, 301, 306, 312, 316, 321, 325, 329,
+	334, 340, 344, 348, 354, 358, 364, 370, 375, 381, 386, 391,
+	395, 401, 407, 413, 419, 424, 430, 435, 439, 441, 445,
+};
+
+sFONT Font8V = {
+  Font8V_Table,
+  4, /* Width: mean advance */
+  8, /* Height */
+  FONT_FORMAT_PROP,
+  Font8V_Widths,
+  Font8V_Offsets,
+};
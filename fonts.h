@@ -50,12 +50,29 @@
 
 /* Includes ------------------------------------------------------------------*/
 #include <stdint.h>
+#ifdef UNIT
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#else
+#include <avr/pgmspace.h>
+#endif
+
+/* Table layouts */
+#define FONT_FORMAT_BYTES   0 /* every glyph row padded to whole bytes */
+#define FONT_FORMAT_PACKED  1 /* glyph rows of exactly Width bits, each glyph padded to a byte (tools/fontpack.py) */
+#define FONT_FORMAT_PROP    2 /* packed rows as wide as each glyph's advance, Width is the mean advance (tools/fontprop.py) */
 
 typedef struct _tFont
 {    
   const uint8_t *table;
   uint16_t Width;
   uint16_t Height;
+  uint8_t Format;
+  const uint8_t *Widths;   /* FONT_FORMAT_PROP: PROGMEM advance of each glyph */
+  const uint16_t *Offsets; /* FONT_FORMAT_PROP: PROGMEM table offset of each glyph */
+  const uint16_t *Codes;   /* PROGMEM code point of each glyph in ascending order, NULL for ASCII 32..126 */
+  uint16_t Count;          /* entries in Codes */
   
 } sFONT;
 
@@ -65,6 +82,18 @@ extern sFONT Font16;
 extern sFONT Font12;
 extern sFONT Font8;
 
+extern sFONT Font24P;
+extern sFONT Font20P;
+extern sFONT Font16P;
+extern sFONT Font12P;
+extern sFONT Font8P;
+
+extern sFONT Font24V;
+extern sFONT Font20V;
+extern sFONT Font16V;
+extern sFONT Font12V;
+extern sFONT Font8V;
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,138 @@
+#ifndef LAYOUT_H
+#define LAYOUT_H
+
+/*
+Compile-time screen layouts. A Layout resolves section boundaries, line widths,
+cell storage and the panel row -> (section, glyph line, sub-row) map while compiling,
+keeping the row map in flash and all section state in static storage:
+
+    typedef Layout<LayoutSection<Font8Spec, 2>, LayoutSection<Font24Spec, 3> > Dash;
+    s.ScreenInit(Dash::Get());
+
+Sections defined this way are used exactly like ones from DefineSection.
+*/
+
+#include "screen.h"
+
+/* font metrics known to the compiler; Width and Height must match the sFONT */
+template<sFONT *F, uint8_t W, uint8_t H>
+struct FontSpec {
+    static sFONT *Font() { return F; }
+    static constexpr uint8_t Width = W;
+    static constexpr uint8_t Height = H;
+};
+
+typedef FontSpec<&Font8, 5, 8> Font8Spec;
+typedef FontSpec<&Font12, 7, 12> Font12Spec;
+typedef FontSpec<&Font16, 11, 16> Font16Spec;
+typedef FontSpec<&Font20, 14, 20> Font20Spec;
+typedef FontSpec<&Font24, 17, 24> Font24Spec;
+typedef FontSpec<&Font8P, 5, 8> Font8PSpec;
+typedef FontSpec<&Font12P, 7, 12> Font12PSpec;
+typedef FontSpec<&Font16P, 11, 16> Font16PSpec;
+typedef FontSpec<&Font20P, 14, 20> Font20PSpec;
+typedef FontSpec<&Font24P, 17, 24> Font24PSpec;
+typedef FontSpec<&Font8V, 4, 8> Font8VSpec;
+typedef FontSpec<&Font12V, 6, 12> Font12VSpec;
+typedef FontSpec<&Font16V, 8, 16> Font16VSpec;
+typedef FontSpec<&Font20V, 9, 20> Font20VSpec;
+typedef FontSpec<&Font24V, 12, 24> Font24VSpec;
+
+/* a section of Lines lines of font F, drawn Scale (1 to 3) times its size */
+template<class F, int Lines, int Scale = 1>
+struct LayoutSection {
+    static_assert(Scale >= 1 && Scale <= 3, "sections scale glyphs 1x, 2x or 3x");
+    typedef F Font;
+    static constexpr int lines = Lines;
+    static constexpr int scale = Scale;
+    static constexpr int lineRows = F::Height * Scale;
+    static constexpr int width = EPD_WIDTH / (F::Width * Scale);
+    static constexpr int rows = lineRows * Lines;
+    static constexpr int cells = width * Lines;
+};
+
+template<int... I> struct LayoutSeq { };
+template<int N, int... I> struct MakeLayoutSeq : MakeLayoutSeq<N - 1, N - 1, I...> { };
+template<int... I> struct MakeLayoutSeq<0, I...> { typedef LayoutSeq<I...> type; };
+
+/* totals and per-index lookups over a list of LayoutSections */
+template<class... S> struct LayoutPack;
+
+template<> struct LayoutPack<> {
+    static constexpr int rows = 0;
+    static constexpr int cells = 0;
+    static constexpr int Cap(int) { return 0; }
+    static constexpr int CellOffset(int) { return 0; }
+    static constexpr LayoutRow Row(int, int) { return LayoutRow{ LAYOUT_BLANK, 0, 0 }; }
+};
+
+template<class H, class... T> struct LayoutPack<H, T...> {
+    typedef LayoutPack<T...> Rest;
+    static constexpr int rows = H::rows + Rest::rows;
+    static constexpr int cells = H::cells + Rest::cells;
+    /* last panel row (exclusive) of section i */
+    static constexpr int Cap(int i) { return i == 0 ? H::rows : H::rows + Rest::Cap(i - 1); }
+    /* first cell of section i */
+    static constexpr int CellOffset(int i) { return i == 0 ? 0 : H::cells + Rest::CellOffset(i - 1); }
+    static constexpr LayoutRow Row(int row, int section) {
+        return row < H::rows
+            ? LayoutRow{ (uint8_t)section, (uint8_t)(row / H::lineRows), (uint8_t)(row % H::lineRows) }
+            : Rest::Row(row - H::rows, section + 1);
+    }
+};
+
+template<class Pack, class SecSeq, class RowSeq, class... S> struct LayoutStorage;
+
+template<class Pack, int... I, int... R, class... S>
+struct LayoutStorage<Pack, LayoutSeq<I...>, LayoutSeq<R...>, S...> {
+    static struct Section descs[sizeof...(S)];
+    static struct Section *descPtrs[sizeof...(S)];
+    static cell_t cells[Pack::cells];
+    static cell_t *cellPtrs[sizeof...(S)];
+    static const LayoutRow rows[EPD_HEIGHT];
+    static const ScreenLayout layout;
+};
+
+template<class Pack, int... I, int... R, class... S>
+struct Section LayoutStorage<Pack, LayoutSeq<I...>, LayoutSeq<R...>, S...>::descs[sizeof...(S)] = {
+    { S::Font::Font(), Pack::Cap(I), S::width, S::lines, 0, S::lines - 1, 0, 0, S::scale }...
+};
+
+template<class Pack, int... I, int... R, class... S>
+struct Section *LayoutStorage<Pack, LayoutSeq<I...>, LayoutSeq<R...>, S...>::descPtrs[sizeof...(S)] = {
+    &descs[I]...
+};
+
+template<class Pack, int... I, int... R, class... S>
+cell_t LayoutStorage<Pack, LayoutSeq<I...>, LayoutSeq<R...>, S...>::cells[Pack::cells];
+
+template<class Pack, int... I, int... R, class... S>
+cell_t *LayoutStorage<Pack, LayoutSeq<I...>, LayoutSeq<R...>, S...>::cellPtrs[sizeof...(S)] = {
+    cells + Pack::CellOffset(I)...
+};
+
+template<class Pack, int... I, int... R, class... S>
+const LayoutRow LayoutStorage<Pack, LayoutSeq<I...>, LayoutSeq<R...>, S...>::rows[EPD_HEIGHT] PROGMEM = {
+    Pack::Row(R, 0)...
+};
+
+template<class Pack, int... I, int... R, class... S>
+const ScreenLayout LayoutStorage<Pack, LayoutSeq<I...>, LayoutSeq<R...>, S...>::layout = {
+    sizeof...(S), descPtrs, cellPtrs, rows
+};
+
+/* a screen made of the given LayoutSections, top to bottom */
+template<class... S>
+struct Layout {
+    typedef LayoutPack<S...> Pack;
+    typedef LayoutStorage<Pack, typename MakeLayoutSeq<sizeof...(S)>::type,
+        typename MakeLayoutSeq<EPD_HEIGHT>::type, S...> Storage;
+    static_assert(sizeof...(S) > 0 && sizeof...(S) < LAYOUT_BLANK, "a layout needs 1 to 254 sections");
+    static_assert(Pack::rows <= EPD_HEIGHT, "layout is taller than the panel");
+
+    static const int sections = sizeof...(S);
+    static const int cells = Pack::cells;
+    static const ScreenLayout *Get() { return &Storage::layout; }
+};
+
+#endif
@@ -1,304 +1,1666 @@
 #include "screen.h"
 
+#ifdef UNIT
+#include "epdsim.h"
+#include <malloc.h>
+
+/* count heap calls so the benchmarks can report allocations */
+long unit_allocs = 0;
+long unit_heap = 0; // bytes requested
+#define malloc(size) (unit_allocs++, unit_heap += (size), malloc(size))
+#define calloc(count, size) (unit_allocs++, unit_heap += (count) * (size), calloc(count, size))
+#endif
+
 #pragma region Init
 
-Screen::Screen() { }
+#ifdef UNIT
+EpdSim defaultEpd;
+#else
+SpiTransport defaultEpd;
+#endif
+
+Screen::Screen() : epd(&defaultEpd) { }
+
+/* drive the panel through another transport, e.g. an EpdSim on host builds */
+Screen::Screen(EpdTransport *transport) : epd(transport) { }
 
 Screen::~Screen() {
     TearDown();
 }
 
-void Screen::ScreenInit(int sectors) {
+/* bring the panel up on first use, otherwise drop the previous layout */
+void Screen::Begin() {
     if (!epdInit) {
-#ifndef UNIT
+        epd->Begin();
         EpdInit();
-#endif
         epdInit = true;
     } else {
         TearDown();
     }
+    fullPending = true;
+    stream.section = -1;
+    rotation = ROTATE_0;
+    canvasWidth = EPD_WIDTH;
+    canvasHeight = EPD_HEIGHT;
+    canvasBytes = LINEBYTES;
+}
 
+void Screen::ScreenInit(int sectors) {
+    Begin();
     sects = sectors;
     secDescs = (struct Section **)calloc(sects, sizeof(struct Section *));
-    secPtrs = (const uint8_t ***)malloc(sects * sizeof(const uint8_t *));
+    secCells = (cell_t **)calloc(sects, sizeof(cell_t *));
+}
+
+/* use sections laid out at compile time (see layout.h); nothing is allocated */
+void Screen::ScreenInit(const ScreenLayout *layout) {
+    Begin();
+    sects = layout->sections;
+    secDescs = layout->descs;
+    secCells = layout->cells;
+    rowMap = layout->rows;
+    for(int s = 0; s < sects; s++) {
+        secDescs[s]->head = 0;
+        secDescs[s]->fill = 0;
+        MarkDirty(s, 0, secDescs[s]->height - 1);
+    }
+}
+
+/* 
+Carve all section state from a caller-owned arena of ArenaBytes() bytes instead of the heap.
+DefineSection then takes each section's cells from what is left and fails when they do not fit.
+The arena is only borrowed, so re-initialising the screen never touches the heap.
+Returns 1 when the arena cannot even hold the section tables.
+*/
+int Screen::ScreenInit(int sectors, uint8_t *buffer, size_t bytes) {
+    Begin();
+    uintptr_t start = ((uintptr_t)buffer + alignof(struct Section) - 1) & ~(uintptr_t)(alignof(struct Section) - 1);
+    size_t skip = start - (uintptr_t)buffer;
+    size_t tables = sectors * (sizeof(struct Section *) + sizeof(cell_t *) + sizeof(struct Section));
+    if(buffer == nullptr || bytes < skip + tables) {
+        sects = 0;
+        return 1;
+    }
+    arena = (uint8_t *)start;
+    arenaSize = bytes - skip;
+    arenaUsed = tables;
+    sects = sectors;
+    // Sections first so they keep the arena alignment, then the two pointer tables
+    struct Section *descs = (struct Section *)arena;
+    secDescs = (struct Section **)(arena + sectors * sizeof(struct Section));
+    secCells = (cell_t **)(arena + sectors * (sizeof(struct Section) + sizeof(struct Section *)));
+    for(int s = 0; s < sects; s++) {
+        secDescs[s] = &descs[s];
+        secCells[s] = nullptr;
+    }
+    return 0;
+}
+
+/* section storage is carved in multiples of the strictest alignment it needs (a chart's header,
+ or a wide cell), so each section starts aligned with no slack between them */
+static size_t ArenaRound(size_t bytes) {
+    return (bytes + alignof(ChartHeader) - 1) / alignof(ChartHeader) * alignof(ChartHeader);
+}
+
+/* bytes of arena ScreenInit(int, uint8_t *, size_t) needs for these sections, including alignment slack.
+ A nullptr font stands for a graphics section holding lines[s] shapes, or a chart section
+ when samples[s] is above 0 */
+size_t Screen::ArenaBytes(int sectors, const int *lines, sFONT *const *fonts, const uint8_t *scales, int rotation, const int *samples) {
+    size_t bytes = alignof(struct Section) - 1 + sectors * (sizeof(struct Section *) + sizeof(cell_t *) + sizeof(struct Section));
+    int across = rotation == ROTATE_90 || rotation == ROTATE_270 ? EPD_HEIGHT : EPD_WIDTH;
+    for(int s = 0; s < sectors; s++) {
+        if(samples != nullptr && samples[s] > 0) { // chart section, clamped as DefineChart does
+            size_t n = samples[s] < across ? samples[s] : across;
+            bytes += ArenaRound(sizeof(ChartHeader) + n * (sizeof(int16_t) + 1));
+        } else if(fonts[s] == nullptr) // graphics section, lines[s] is its shape count
+            bytes += ArenaRound(lines[s] * sizeof(Shape));
+        else
+            bytes += ArenaRound((size_t)(across / (fonts[s]->Width * (scales != nullptr ? scales[s] : 1))) * lines[s] * sizeof(cell_t));
+    }
+    return bytes;
 }
 
 void Screen::TearDown() {
-    if(secPtrs != nullptr) {
+    if(rowMap != nullptr || arena != nullptr) { // static layout or arena storage
+        rowMap = nullptr;
+        arena = nullptr;
+        arenaSize = 0;
+        arenaUsed = 0;
+        secCells = nullptr;
+        secDescs = nullptr;
+    }
+    if(secCells != nullptr) {
         for(int i = 0; i < sects; i++) {
-            if(secPtrs[i] != nullptr) {
-                free((void *)secPtrs[i]);
+            if(secCells[i] != nullptr) {
+                free((void *)secCells[i]);
             }
             if(secDescs[i] != nullptr) {
                 free(secDescs[i]);
             }
         }
-        free(secPtrs);
+        free(secCells);
         free(secDescs);
+        secCells = nullptr;
+        secDescs = nullptr;
     }
 }
 
 /* 
 Configures a section of the screen, giving it a fixed number of lines
-for the provided font size.
+for the provided font size. A scale of 2 or 3 draws the font that many times larger
+by repeating its pixels, so big text needs no extra font table.
 ## sections must be defined in order ## 
 */
-int Screen::DefineSection(int section, int lines, sFONT *font) {
-    if (section < sects && section >= 0) {
+int Screen::DefineSection(int section, int lines, sFONT *font, uint8_t scale) {
+    if(scale < 1 || scale > 3)
+        return 1;
+    int width = canvasWidth / (font->Width * scale);
+    struct Section *sec = NewSection(section, font, lines, font->Height * scale, width, width * lines * sizeof(cell_t));
+    if(sec == nullptr)
+        return 1;
+    sec->scale = scale;
+    return 0;
+}
+
+/* the next section with bytes of zeroed storage: lines of lineRows pixel rows each, width cells,
+ shapes or samples, all of it dirty. Returns nullptr when the section number is out of range
+ or the storage cannot be had. Each Define* fills in what is particular to its kind */
+struct Section *Screen::NewSection(int section, sFONT *font, int lines, int lineRows, int width, size_t bytes) {
+    if(section < 0 || section >= sects || AllocSection(section, bytes))
+        return nullptr;
+    struct Section *sec = secDescs[section];
+    sec->font = font;
+    sec->height = lines;
+    sec->cap = lineRows * lines + (section == 0 ? 0 : secDescs[section - 1]->cap);
+    sec->width = width;
+    sec->scale = 1;
+    sec->head = 0;
+    sec->fill = 0;
+    sec->dirtyFirst = -1;
+    MarkDirty(section, 0, lines - 1);
+    return sec;
+}
+
+/* the descriptor and bytes of zeroed storage for a section, from the arena when there is one */
+int Screen::AllocSection(int section, size_t bytes) {
+    if(arena != nullptr) {
+        if(arenaUsed + ArenaRound(bytes) > arenaSize)
+            return 1;
+        secCells[section] = (cell_t *)(arena + arenaUsed);
+        memset(secCells[section], CELL_EMPTY, bytes);
+        arenaUsed += ArenaRound(bytes);
+    } else {
         secDescs[section] = (struct Section *)malloc(sizeof(struct Section));
-        secDescs[section]->font = font;
-        secDescs[section]->height = lines;
-        secDescs[section]->cap = section == 0 ? font->Height * lines : font->Height * lines + secDescs[section - 1]->cap;
-        secDescs[section]->width = EPD_WIDTH / font->Width;
-        int charC = (secDescs[section]->width) * lines;
-        secPtrs[section] = (const uint8_t **)malloc(charC * sizeof(void *));
-        return 0;
+        secCells[section] = (cell_t *)calloc(bytes, 1);
     }
-    return 1;
+    return 0;
+}
+
+/* stand in for the font of graphics and chart sections: every line is one pixel row */
+static sFONT graphicsRows = { nullptr, 1, 1, FONT_FORMAT_BYTES };
+static sFONT chartRows = { nullptr, 1, 1, FONT_FORMAT_BYTES };
+static sFONT imageRows = { nullptr, 1, 1, FONT_FORMAT_BYTES };
+
+/*
+Configures a graphics section of rows pixel rows holding up to shapes lines, rectangles
+and bars (see AddShape). Shapes are kept as a display list of 6 bytes each and rasterised
+a scanline at a time as rows are composed, so RAM grows with the shapes rather than the pixels.
+## sections must be defined in order ##
+*/
+int Screen::DefineGraphics(int section, int rows, int shapes) {
+    if(rows < 1 || rows > EPD_HEIGHT || shapes < 0)
+        return 1;
+    return NewSection(section, &graphicsRows, rows, 1, shapes, shapes * sizeof(Shape)) == nullptr;
+}
+
+/*
+Configures a chart section of rows pixel rows plotting the last samples values added with AddSample,
+one per pixel column with the newest at the right edge, as a line (CHART_LINE) or bars (CHART_BARS).
+The vertical scale follows the range of the samples held. Each sample costs 3 bytes.
+## sections must be defined in order ##
+*/
+int Screen::DefineChart(int section, int rows, int samples, uint8_t style) {
+    if(rows < 1 || rows > EPD_HEIGHT || samples < 1 || style > CHART_BARS)
+        return 1;
+    if(samples > canvasWidth)
+        samples = canvasWidth;
+    if(NewSection(section, &chartRows, rows, 1, samples, sizeof(ChartHeader) + samples * (sizeof(int16_t) + 1)) == nullptr)
+        return 1;
+    ((ChartHeader *)secCells[section])->style = style;
+    return 0;
+}
+
+/*
+Configures an image section of rows pixel rows whose pixels live only in the panel's RAM.
+BeginImage streams a picture straight into them, and draws leave those rows alone apart from
+blanking them on the first draw after DefineImage. Portrait only; takes no storage.
+## sections must be defined in order ##
+*/
+int Screen::DefineImage(int section, int rows) {
+    if(rows < 1 || rows > EPD_HEIGHT || rotation != ROTATE_0)
+        return 1;
+    return NewSection(section, &imageRows, rows, 1, 0, 0) == nullptr;
+}
+
+/* true for graphics, chart and image sections, which hold pixels rather than cells */
+bool Screen::IsGraphics(int section) {
+    return secDescs[section]->font->table == nullptr;
+}
+
+/*
+Lay the sections out on a canvas turned by ROTATE_90, ROTATE_180 or ROTATE_270 on the panel.
+In landscape the canvas is 250 pixels wide and 122 tall; lines get wider and sections stack
+across the short side. Call after ScreenInit and before DefineSection. Compile-time layouts
+are built for portrait and only take ROTATE_0 or ROTATE_180. Returns 1 when refused.
+*/
+int Screen::SetRotation(int rot) {
+    bool landscape = rot == ROTATE_90 || rot == ROTATE_270;
+    if(rot < ROTATE_0 || rot > ROTATE_270 || (landscape && rowMap != nullptr))
+        return 1;
+    rotation = rot;
+    canvasWidth = landscape ? EPD_HEIGHT : EPD_WIDTH;
+    canvasHeight = landscape ? EPD_WIDTH : EPD_HEIGHT;
+    canvasBytes = (canvasWidth + LINEPAD + 7) / 8;
+    fullPending = true;
+    return 0;
+}
+
+/* flag lines [first, last] of a section as changed since the last Draw */
+void Screen::MarkDirty(int section, int first, int last) {
+    struct Section *sec = secDescs[section];
+    if(sec->dirtyFirst < 0) {
+        sec->dirtyFirst = first;
+        sec->dirtyLast = last;
+        return;
+    }
+    if(first < sec->dirtyFirst)
+        sec->dirtyFirst = first;
+    if(last > sec->dirtyLast)
+        sec->dirtyLast = last;
+}
+
+void Screen::ClearDirty() {
+    for(int s = 0; s < sects; s++) {
+        secDescs[s]->dirtyFirst = -1;
+        secDescs[s]->dirtyLast = -1;
+    }
+}
+
+/*
+Get the span of panel rows touched since the last Draw. Returns false when nothing changed.
+In landscape every changed canvas row crosses all panel rows, so the span is the whole panel.
+*/
+bool Screen::GetDirtyRows(int *first, int *last) {
+    *first = EPD_HEIGHT;
+    *last = -1;
+    for(int s = 0; s < sects; s++) {
+        struct Section *sec = secDescs[s];
+        if(sec->dirtyFirst < 0)
+            continue;
+        int base = s == 0 ? 0 : secDescs[s - 1]->cap;
+        int lineRows = sec->font->Height * sec->scale;
+        int top = base + sec->dirtyFirst * lineRows;
+        int bottom = base + (sec->dirtyLast + 1) * lineRows - 1;
+        if(top < *first)
+            *first = top;
+        if(bottom > *last)
+            *last = bottom;
+    }
+    if(*last >= canvasHeight)
+        *last = canvasHeight - 1;
+    if(*last < *first)
+        return false;
+    if(rotation == ROTATE_180) {
+        int top = *first;
+        *first = EPD_HEIGHT - 1 - *last;
+        *last = EPD_HEIGHT - 1 - top;
+    } else if(rotation != ROTATE_0) {
+        *first = 0;
+        *last = EPD_HEIGHT - 1;
+    }
+    return true;
+}
+
+/*
+RAM held for a section: its descriptor, one cell per character position and the two table slots.
+Pass -1 for the total over all sections.
+*/
+size_t Screen::SectionBytes(int section) {
+    if(section < 0) {
+        size_t total = 0;
+        for(int s = 0; s < sects; s++)
+            total += SectionBytes(s);
+        return total;
+    }
+    if(section >= sects || secDescs[section] == nullptr)
+        return 0;
+    struct Section *sec = secDescs[section];
+    size_t data = (size_t)sec->width * sec->height * sizeof(cell_t);
+    if(sec->font == &graphicsRows)
+        data = sec->width * sizeof(Shape);
+    else if(sec->font == &chartRows)
+        data = sizeof(ChartHeader) + sec->width * (sizeof(int16_t) + 1);
+    return sizeof(struct Section) + data + sizeof(struct Section *) + sizeof(cell_t *);
 }
 
 #pragma endregion
 
 #pragma region Utils
 
-inline unsigned char rev_byte(unsigned char c) {
-    unsigned char b = 0;
-    for (int i = 0; i < 8; i++)
-    {
-        b = b << 1;
-        b |= (c >> i) & 0x1;
+/* composed line byte (ink = 1, leftmost pixel in the MSB) to panel byte: bit reversed and inverted */
+const unsigned char panel_byte[256] PROGMEM = {
+    0xFF,0x7F,0xBF,0x3F,0xDF,0x5F,0x9F,0x1F,0xEF,0x6F,0xAF,0x2F,0xCF,0x4F,0x8F,0x0F,
+    0xF7,0x77,0xB7,0x37,0xD7,0x57,0x97,0x17,0xE7,0x67,0xA7,0x27,0xC7,0x47,0x87,0x07,
+    0xFB,0x7B,0xBB,0x3B,0xDB,0x5B,0x9B,0x1B,0xEB,0x6B,0xAB,0x2B,0xCB,0x4B,0x8B,0x0B,
+    0xF3,0x73,0xB3,0x33,0xD3,0x53,0x93,0x13,0xE3,0x63,0xA3,0x23,0xC3,0x43,0x83,0x03,
+    0xFD,0x7D,0xBD,0x3D,0xDD,0x5D,0x9D,0x1D,0xED,0x6D,0xAD,0x2D,0xCD,0x4D,0x8D,0x0D,
+    0xF5,0x75,0xB5,0x35,0xD5,0x55,0x95,0x15,0xE5,0x65,0xA5,0x25,0xC5,0x45,0x85,0x05,
+    0xF9,0x79,0xB9,0x39,0xD9,0x59,0x99,0x19,0xE9,0x69,0xA9,0x29,0xC9,0x49,0x89,0x09,
+    0xF1,0x71,0xB1,0x31,0xD1,0x51,0x91,0x11,0xE1,0x61,0xA1,0x21,0xC1,0x41,0x81,0x01,
+    0xFE,0x7E,0xBE,0x3E,0xDE,0x5E,0x9E,0x1E,0xEE,0x6E,0xAE,0x2E,0xCE,0x4E,0x8E,0x0E,
+    0xF6,0x76,0xB6,0x36,0xD6,0x56,0x96,0x16,0xE6,0x66,0xA6,0x26,0xC6,0x46,0x86,0x06,
+    0xFA,0x7A,0xBA,0x3A,0xDA,0x5A,0x9A,0x1A,0xEA,0x6A,0xAA,0x2A,0xCA,0x4A,0x8A,0x0A,
+    0xF2,0x72,0xB2,0x32,0xD2,0x52,0x92,0x12,0xE2,0x62,0xA2,0x22,0xC2,0x42,0x82,0x02,
+    0xFC,0x7C,0xBC,0x3C,0xDC,0x5C,0x9C,0x1C,0xEC,0x6C,0xAC,0x2C,0xCC,0x4C,0x8C,0x0C,
+    0xF4,0x74,0xB4,0x34,0xD4,0x54,0x94,0x14,0xE4,0x64,0xA4,0x24,0xC4,0x44,0x84,0x04,
+    0xF8,0x78,0xB8,0x38,0xD8,0x58,0x98,0x18,0xE8,0x68,0xA8,0x28,0xC8,0x48,0x88,0x08,
+    0xF0,0x70,0xB0,0x30,0xD0,0x50,0x90,0x10,0xE0,0x60,0xA0,0x20,0xC0,0x40,0x80,0x00,
+};
+
+/* start writing at bit startBit of dst; bits before it are kept */
+inline void blit_begin(Blitter *b, unsigned char *dst, uint8_t startBit) {
+    b->dst = dst + startBit / 8;
+    b->bits = startBit % 8;
+    b->acc = b->bits ? (*b->dst >> (8 - b->bits)) : 0;
+}
+
+/* append the low n bits of row (n <= 24), whole bytes are stored as soon as BLIT_CHUNK bits are pending */
+inline void blit_push(Blitter *b, uint32_t row, uint8_t n) {
+    b->acc = (b->acc << n) | row;
+    b->bits += n;
+    while(b->bits >= BLIT_CHUNK) {
+        b->bits -= BLIT_CHUNK;
+        for(uint8_t k = BLIT_CHUNK; k > 0; k -= 8)
+            *b->dst++ = (unsigned char)(b->acc >> (b->bits + k - 8));
     }
-    return b;
 }
 
-/* write the provided input into the destination (assume that the input is aligned left)  */
-inline void writebuf(unsigned char *input, unsigned char *dst, uint8_t startBit, uint8_t lengthBits) {
-    unsigned char byte = input[0];
-    // write non-aligned
-    uint8_t mask, rem, oft, index = startBit / 8;
-    oft = startBit % 8;
-    rem = 8-oft;
-    mask = ((1 << rem) - 1); // 0^oft||1^(rem)
-    // if whole thing fits in first byte
-    if(lengthBits+oft < 8) { 
-        rem = lengthBits;
-        mask = mask << 8-lengthBits-oft;
+/* store the pending bits, the rest of the last byte is kept */
+inline void blit_end(Blitter *b) {
+    while(b->bits >= 8) {
+        b->bits -= 8;
+        *b->dst++ = (unsigned char)(b->acc >> b->bits);
     }
-    byte = (byte >> oft) & mask;
-    dst[index] |= byte;
-    index++;
-    // write aligned
-    uint8_t alignedBytes = (lengthBits - rem)/8;
-    int i;
-    for(i = 0; i < alignedBytes; i++) {\
-        // mask in case of arithmetic shift
-        byte = (input[i] << rem) | ((input[i+1] >> oft) & mask);
-        dst[index + i] = byte;
+    if(b->bits) {
+        uint8_t keep = 0xFF >> b->bits;
+        *b->dst = (*b->dst & keep) | (unsigned char)(b->acc << (8 - b->bits));
     }
-    // write non-aligned
-    uint8_t lastSize = lengthBits - (8 * alignedBytes) - rem;
-    mask = ~((1 << (8 - lastSize)) - 1);
-    if(lastSize != 0) {
-        byte = ((input[i] << rem) | (input[i+1] >> oft)) & mask;
-        dst[index + alignedBytes] |= byte;
+}
+
+/* a nibble with every pixel doubled, for 2x sections */
+const uint8_t scale2_nibble[16] PROGMEM = {
+    0x00,0x03,0x0C,0x0F,0x30,0x33,0x3C,0x3F,0xC0,0xC3,0xCC,0xCF,0xF0,0xF3,0xFC,0xFF,
+};
+
+/* a nibble with every pixel tripled, for 3x sections */
+const uint16_t scale3_nibble[16] PROGMEM = {
+    0x000,0x007,0x038,0x03F,0x1C0,0x1C7,0x1F8,0x1FF,0xE00,0xE07,0xE38,0xE3F,0xFC0,0xFC7,0xFF8,0xFFF,
+};
+
+/* append the low width bits of row with each pixel repeated scale (2 or 3) times,
+ a nibble at a time from the left; the first nibble holds the width % 4 odd bits */
+inline void blit_scaled(Blitter *b, uint32_t row, uint8_t width, uint8_t scale) {
+    if(row == 0) { // blank rows, spaces and the gaps below short glyphs
+        for(uint8_t n = width * scale; n > 0; n -= n > 24 ? 24 : n)
+            blit_push(b, 0, n > 24 ? 24 : n);
+        return;
+    }
+    uint8_t bits = width % 4 ? width % 4 : 4;
+    for(int8_t shift = width - bits; shift >= 0; shift -= 4, bits = 4) {
+        uint8_t nibble = (row >> shift) & ((1 << bits) - 1);
+        if(scale == 2)
+            blit_push(b, pgm_read_byte(&scale2_nibble[nibble]), bits * 2);
+        else
+            blit_push(b, pgm_read_word(&scale3_nibble[nibble]), bits * 3);
+    }
+}
+
+/* transpose an 8x8 bit block: bit 7 - c of out[r] is bit 7 - r of in[c], MSB first both ways.
+ Three rounds of masked swaps on two 32 bit halves, as in Hacker's Delight 7-3 */
+inline void transpose8(const uint8_t *in, uint8_t *out) {
+    uint32_t x = ((uint32_t)in[0] << 24) | ((uint32_t)in[1] << 16) | ((uint32_t)in[2] << 8) | in[3];
+    uint32_t y = ((uint32_t)in[4] << 24) | ((uint32_t)in[5] << 16) | ((uint32_t)in[6] << 8) | in[7];
+    uint32_t t;
+    t = (x ^ (x >> 7)) & 0x00AA00AA; x = x ^ t ^ (t << 7);
+    t = (y ^ (y >> 7)) & 0x00AA00AA; y = y ^ t ^ (t << 7);
+    t = (x ^ (x >> 14)) & 0x0000CCCC; x = x ^ t ^ (t << 14);
+    t = (y ^ (y >> 14)) & 0x0000CCCC; y = y ^ t ^ (t << 14);
+    t = (x & 0xF0F0F0F0) | ((y >> 4) & 0x0F0F0F0F);
+    y = ((x << 4) & 0xF0F0F0F0) | (y & 0x0F0F0F0F);
+    x = t;
+    out[0] = x >> 24; out[1] = x >> 16; out[2] = x >> 8; out[3] = x;
+    out[4] = y >> 24; out[5] = y >> 16; out[6] = y >> 8; out[7] = y;
+}
+
+/* a composed line flipped left to right, the LINEPAD blank bits kept at the start */
+inline void line_mirror(const unsigned char *src, unsigned char *dst) {
+    uint8_t prev = 0;
+    for(uint8_t h = 0; h < LINEBYTES; h++) {
+        uint8_t r = ~pgm_read_byte(&panel_byte[src[LINEBYTES - 1 - h]]); // bit reversed
+        dst[h] = (uint8_t)(prev << (8 - LINEPAD)) | (r >> LINEPAD);
+        prev = r;
+    }
+}
+
+/* pixel runs a shape covers on section row y as [first, last] pairs in run; returns how many, 0 to 2.
+ Lines are Bresenham's, stepping from (x0, y0) with the error starting at half the major delta,
+ solved for the row so any scanline can be drawn on its own */
+inline uint8_t shape_runs(const Shape *sh, int y, int16_t *run) {
+    int top = sh->y0 < sh->y1 ? sh->y0 : sh->y1, bottom = sh->y0 < sh->y1 ? sh->y1 : sh->y0;
+    if(y < top || y > bottom)
+        return 0;
+    if((sh->kind == SHAPE_RECT || sh->kind == SHAPE_BAR) && y != top && y != bottom) {
+        run[0] = sh->x0;
+        run[1] = sh->kind == SHAPE_BAR && sh->x1 > sh->x0 + 1 ? sh->x0 + (int32_t)(sh->x1 - sh->x0 - 1) * sh->value / 255 : sh->x0;
+        run[2] = run[3] = sh->x1;
+        return 2;
+    }
+    if(sh->kind == SHAPE_LINE && sh->y0 != sh->y1) {
+        int dx = sh->x1 - sh->x0, dy = sh->y1 - sh->y0;
+        int adx = dx < 0 ? -dx : dx, ady = dy < 0 ? -dy : dy;
+        if(adx >= ady) { // x0 <= x1, a run per row: steps k where the y error has wrapped j times
+            int j = y > sh->y0 ? y - sh->y0 : sh->y0 - y, half = adx / 2;
+            int first = j == 0 ? 0 : ((j - 1) * adx + half) / ady + 1;
+            int last = (j * adx + half) / ady;
+            run[0] = sh->x0 + first;
+            run[1] = sh->x0 + (last < adx ? last : adx);
+        } else { // y0 <= y1, one pixel per row
+            int j = y - sh->y0, half = ady / 2;
+            int n = (j * adx - half + ady - 1) / ady;
+            run[0] = run[1] = dx < 0 ? sh->x0 - n : sh->x0 + n;
+        }
+        return 1;
+    }
+    run[0] = sh->x0;
+    run[1] = sh->x1;
+    return 1;
+}
+
+/* row a chart sample plots at, the top row for hi and the bottom one for lo; level data sits mid-height */
+inline uint8_t chart_row(int value, int lo, int hi, int rows) {
+    if(hi == lo)
+        return (rows - 1) / 2;
+    return (rows - 1) - ((int32_t)value - lo) * (rows - 1) / ((int32_t)hi - lo);
+}
+
+/* whether a chart column is inked on row y: bars fill below the sample, lines join it to the one before */
+inline bool chart_pixel(uint8_t style, uint8_t prev, uint8_t cur, int y) {
+    if(style == CHART_BARS)
+        return y >= cur;
+    return prev < cur ? y >= prev && y <= cur : y >= cur && y <= prev;
+}
+
+/* set bits [first, last] of a line */
+inline void line_run(unsigned char *line, int first, int last) {
+    int a = first / 8, b = last / 8;
+    uint8_t head = 0xFF >> (first % 8), tail = 0xFF << (7 - last % 8);
+    if(a == b) {
+        line[a] |= head & tail;
+        return;
+    }
+    line[a] |= head;
+    for(int i = a + 1; i < b; i++)
+        line[i] = 0xFF;
+    line[b] |= tail;
+}
+
+/* bytes of font table per glyph, for the fixed-width formats */
+inline unsigned int font_glyph_bytes(const sFONT *font) {
+    if(font->Format == FONT_FORMAT_PACKED)
+        return (font->Width * font->Height + 7) / 8;
+    return font->Height * ((font->Width + 7) / 8);
+}
+
+/* row subln of a glyph, right aligned in the low width bits; blank for nullptr.
+ Packed rows are read straight from the bit stream, touching only the bytes the row spans */
+__attribute__((always_inline)) inline uint32_t glyph_row(const uint8_t *frame, uint8_t width, uint8_t subln, bool packed) {
+    if(frame == nullptr)
+        return 0;
+    uint8_t bytes, oft;
+    if(packed) {
+        unsigned int bit = (unsigned int)subln * width;
+        frame += bit / 8;
+        oft = bit % 8;
+        bytes = (oft + width + 7) / 8;
+    } else {
+        frame += ((width + 7) / 8) * subln;
+        oft = 0;
+        bytes = (width + 7) / 8;
+    }
+    uint32_t row = 0;
+    for(uint8_t b = 0; b < bytes; b++)
+        row = (row << 8) | pgm_read_byte(frame + b);
+    return (row >> (8 * bytes - oft - width)) & (((uint32_t)1 << width) - 1);
+}
+
+/* decode the UTF-8 sequence at s into code and return its length in bytes.
+ Malformed input decodes as U+FFFD: a stray byte alone, a truncated sequence up to the byte that breaks it */
+inline uint8_t utf8_next(const char *s, uint32_t *code) {
+    uint8_t c = (uint8_t)s[0], len;
+    uint32_t min;
+    if(c < 0x80) {
+        *code = c;
+        return 1;
+    } else if((c & 0xE0) == 0xC0) {
+        len = 2; min = 0x80; *code = c & 0x1F;
+    } else if((c & 0xF0) == 0xE0) {
+        len = 3; min = 0x800; *code = c & 0x0F;
+    } else if((c & 0xF8) == 0xF0) {
+        len = 4; min = 0x10000; *code = c & 0x07;
+    } else {
+        *code = 0xFFFD;
+        return 1;
+    }
+    for(uint8_t i = 1; i < len; i++) {
+        if(((uint8_t)s[i] & 0xC0) != 0x80) {
+            *code = 0xFFFD;
+            return i;
+        }
+        *code = (*code << 6) | ((uint8_t)s[i] & 0x3F);
+    }
+    if(*code < min || *code > 0x10FFFF) // overlong or out of range
+        *code = 0xFFFD;
+    return len;
+}
+
+int utf8_count(const char *s) {
+    int n = 0;
+    uint32_t code;
+    for(; *s != '\0'; n++)
+        s += utf8_next(s, &code);
+    return n;
+}
+
+/* glyph index of a code point in a font, -1 when it has none. Mapped fonts usually open with
+ a run of ASCII, so the index the code would have in such a run is probed before a binary search */
+inline int font_glyph_index(const sFONT *font, uint32_t code) {
+    if(font->Codes == nullptr)
+        return code >= ' ' && code <= '~' ? (int)(code - ' ') : -1;
+    if(code > 0xFFFF || font->Count == 0)
+        return -1;
+    uint16_t first = pgm_read_word(&font->Codes[0]);
+    if(code >= first && code - first < font->Count && pgm_read_word(&font->Codes[code - first]) == code)
+        return code - first;
+    int lo = 0, hi = font->Count - 1;
+    while(lo <= hi) {
+        int mid = (unsigned int)(lo + hi) / 2;
+        uint16_t at = pgm_read_word(&font->Codes[mid]);
+        if(at == code)
+            return mid;
+        if(at < code)
+            lo = mid + 1;
+        else
+            hi = mid - 1;
     }
+    return -1;
+}
+
+/* cell for a code point: its glyph, else the fallback glyph, else empty */
+__attribute__((always_inline)) inline cell_t code_cell(const sFONT *font, uint32_t code, uint32_t fallback) {
+    if(font->Codes == nullptr && code - ' ' < 95) // plain ASCII font
+        return (cell_t)(code - ' ' + 1);
+    int g = font_glyph_index(font, code);
+    if(g < 0)
+        g = font_glyph_index(font, fallback);
+    return g < 0 || g >= CELL_MAX ? CELL_EMPTY : (cell_t)(g + 1);
+}
+
+/* pixels the glyph in a cell advances in a FONT_FORMAT_PROP font */
+inline uint8_t cell_advance(const sFONT *font, cell_t cell) {
+    return cell == CELL_EMPTY ? 0 : pgm_read_byte(&font->Widths[cell - 1]);
+}
+
+/* font table address of the glyph in a cell, nullptr when empty */
+inline const uint8_t *cell_glyph(const uint8_t *table, cell_t cell, unsigned int glyphBytes) {
+    return cell == CELL_EMPTY ? nullptr : table + (cell - 1) * glyphBytes;
+}
+
+/* append row subln of count cells drawn in a font of the given width */
+__attribute__((always_inline)) inline void blit_glyphs(Blitter *b, const cell_t *cells, uint8_t count, const uint8_t *table,
+        unsigned int glyphBytes, uint8_t width, uint8_t subln, bool packed) {
+    for(uint8_t i = 0; i < count; i++)
+        blit_push(b, glyph_row(cell_glyph(table, cells[i], glyphBytes), width, subln, packed), width);
+}
+
+/* blit_glyphs specialised for a fixed font width and format so the shifts and row byte count are constants */
+template<uint8_t W, bool Packed>
+void blit_glyphs_w(Blitter *b, const cell_t *cells, uint8_t count, const uint8_t *table, unsigned int glyphBytes, uint8_t subln) {
+    blit_glyphs(b, cells, count, table, glyphBytes, W, subln, Packed);
 }
 
 #pragma endregion
 
 #pragma region Input
 /* print txt to the next line in the specified section. Performs any requested formatting
+ straight into the section cells, reading txt once and without a staging buffer.
+ With PRINT_WRAP OR'ed into align, lines break after the last whole word that fits, words longer
+ than a line are split at the width and spaces at a wrap are dropped.
+ Returns how many characters of txt did not fit in the section
  -- txt should not include any unprintable characters except newline and null termination*/
-void Screen::Print(int section, char *txt, int align=ALIGN_LEFT) {
+int Screen::Print(int section, char *txt, int align) {
+    if(section < 0 || section >= sects || IsGraphics(section))
+        return utf8_count(txt);
+    ResetRing(section);
+    cell_t *cells = secCells[section];
     int w = secDescs[section]->width;
     int h = secDescs[section]->height;
-    char *buffer = (char *)malloc((w * h * sizeof(char)) + 1);
-    int start = 0; int end = 0;
+    sFONT *font = secDescs[section]->font;
+    bool prop = font->Format == FONT_FORMAT_PROP;
+    int scale = secDescs[section]->scale;
+    int room = prop ? canvasWidth : w; // line length in cells, or pixels for proportional fonts
+    // padding is the font's own space; one without (e.g. converted from BDF) pads with empty cells and cannot align
+    cell_t blank = font_glyph_index(font, ' ') >= 0 ? code_cell(font, ' ', fallback) : CELL_EMPTY;
+    int space = prop ? cell_advance(font, blank) * scale : 1;
+    int spaceCost = prop ? cell_advance(font, code_cell(font, ' ', fallback)) * scale : 1; // a space in txt
+    bool wrap = align & PRINT_WRAP;
+    align &= ~PRINT_WRAP;
+    bool ended = false; // lines after the end of txt are left empty
     for(int line = 0; line < h; line++) {
-        // get next line
-        while(txt[end] != '\0' && txt[end] != '\n' && end - start != w)
-            end++;
-        if((end - start) == w || align == ALIGN_LEFT) {
-            for (int i = 0; i < w; i++)
-                buffer[line * w + i] = i < end-start ? txt[start + i] : ' ';
-        } else if(align == ALIGN_RIGHT) {
-            int bc = w - end + start; //begin characters
-            for(int i = 0; i < w; i++)
-                buffer[line*w + i] = i < bc ? ' ' : txt[start + i - bc];
-        } else { // align = center
-            int ws0 = (w - end + start) / 2; // whitespace 0
-            int ws1 = ws0 + end - start;
-            for(int i = 0; i < w; i++)
-                buffer[line * w + i] = i < ws0 || i >= ws1 ? ' ' : txt[start + i - ws0];
-        }
-        if(txt[end] == '\n') {
-            start = end+1;
-            end = start;
-        }
-        else if(txt[end] == '\0') {
-            buffer[(line+1) * w] = '\0';
-            break;
+        cell_t *row = cells + line * w;
+        bool changed = false;
+        if(ended) {
+            for(int i = 0; i < w; i++) {
+                changed |= row[i] != CELL_EMPTY;
+                row[i] = CELL_EMPTY;
+            }
         } else {
-            start = end;
-            end = start;
+            // next line is as much of txt as fits, ending early at a newline or the end of txt
+            int n = 0, len = 0, used = 0; // characters, bytes and room taken
+            int brk = 0, brkLen = 0, brkUsed = 0; // last space following a word, where a wrapped line can end
+            while(txt[len] != '\0' && txt[len] != '\n' && n != w) {
+                uint32_t code;
+                uint8_t size = utf8_next(txt + len, &code);
+                int cost = prop ? cell_advance(font, code_cell(font, code, fallback)) * scale : 1;
+                if(used + cost > room)
+                    break;
+                if(txt[len] == ' ' && len > 0 && txt[len - 1] != ' ') {
+                    brk = n;
+                    brkLen = len;
+                    brkUsed = used;
+                }
+                used += cost;
+                len += size;
+                n++;
+            }
+            int next = len; // start of the following line
+            bool wrapped = wrap && txt[len] != '\0' && txt[len] != '\n';
+            if(wrapped) {
+                if(txt[len] != ' ' && brk > 0) { // mid-word, back up to the last word that fits
+                    n = brk;
+                    len = next = brkLen;
+                    used = brkUsed;
+                }
+                while(n > 0 && txt[len - 1] == ' ') {
+                    n--;
+                    len--;
+                    used -= spaceCost;
+                }
+            }
+            int lead = 0; // spaces before the text
+            if(align == ALIGN_RIGHT && space > 0)
+                lead = (room - used) / space;
+            else if(align == ALIGN_CENTER && space > 0)
+                lead = (room - used) / 2 / space;
+            if(lead > w - n)
+                lead = w - n;
+            const char *p = txt;
+            for(int i = 0; i < w; i++) {
+                cell_t cell = blank;
+                if(i >= lead && i < lead + n) {
+                    uint32_t code;
+                    p += utf8_next(p, &code);
+                    cell = code_cell(font, code, fallback);
+                }
+                if(row[i] != cell) {
+                    row[i] = cell;
+                    changed = true;
+                }
+            }
+            txt += next;
+            if(wrapped) {
+                while(*txt == ' ')
+                    txt++;
+                if(*txt == '\n') // the wrap already ended this line
+                    txt++;
+                else if(*txt == '\0')
+                    ended = true;
+            } else if(*txt == '\n')
+                txt++;
+            else if(*txt == '\0')
+                ended = true;
         }
+        if(changed)
+            MarkDirty(section, line, line);
     }
-
-    AddText(section, buffer);
-    free(buffer);
+    return ended ? 0 : utf8_count(txt);
 }
 
-/* Write text to the specified section, overwriting any previous text*/
-void Screen::AddText(int section, char *txt) {
-    const uint8_t **secData = secPtrs[section];
+/* Write text to the specified section, overwriting any previous text.
+ Lines whose glyphs differ from what is already stored are marked dirty for the next Draw.
+ Text runs on from one line to the next; with a proportional font a line also ends before
+ the first glyph that would cross the panel edge. Returns how many characters of txt did not fit */
+int Screen::AddText(int section, char *txt) {
+    if(section < 0 || section >= sects || IsGraphics(section))
+        return utf8_count(txt);
+    ResetRing(section);
+    cell_t *secData = secCells[section];
     int w = secDescs[section]->width;
     int h = secDescs[section]->height;
     sFONT *font = secDescs[section]->font;
+    bool prop = font->Format == FONT_FORMAT_PROP;
+    int scale = secDescs[section]->scale;
     bool nullTerm = false;
-    unsigned int char_offset;
-    unsigned int factor = font->Height * (font->Width / 8 + (font->Width % 8 ? 1 : 0));
     for(int i = 0; i < h; i++) {
+        int used = 0; // pixels taken, proportional fonts only
+        bool full = false;
         for(int j = 0; j < w; j++) {
             int index = i * w + j;
-            if(nullTerm) {
-                secData[index] = nullptr;
-                continue;
+            cell_t cell = CELL_EMPTY;
+            if(!nullTerm && !full) {
+                if (*txt == '\0') {
+                    nullTerm = true;
+                } else {
+                    uint32_t code;
+                    uint8_t size = utf8_next(txt, &code);
+                    cell = code_cell(font, code, fallback);
+                    if(prop) {
+                        used += cell_advance(font, cell) * scale;
+                        full = used > canvasWidth;
+                    }
+                    if(full) // the glyph starts the next line
+                        cell = CELL_EMPTY;
+                    else
+                        txt += size;
+                }
             }
-            char c = txt[i * w + j];
-            if (c == '\0') {
-                nullTerm = true;
-                secData[index] = nullptr;
-                continue;
-            } else {
-                char_offset = (c - ' ') * factor;
-#ifdef UNIT
-                secData[index] = (const uint8_t *)c;
-#else
-                secData[index] = &font->table[char_offset];
-#endif
+            if(secData[index] != cell) {
+                secData[index] = cell;
+                MarkDirty(section, i, i);
             }
         }
     }
+    return utf8_count(txt);
 }
 
-#pragma endregion
-
-#pragma region Output
+/*
+Append one line of text to the bottom of a section, like a terminal. Until the section is full
+lines fill it top down; after that the oldest line is overwritten in place and the ring head moves,
+so each append costs one line of cells however tall the section is. Text past the section width, the
+panel edge (whole glyphs, for proportional fonts) or a newline is dropped. A scroll marks the whole section dirty, which Draw sends as a partial refresh
+of just the section rows.
+*/
+int Screen::AppendLine(int section, const char *txt) {
+    if(section < 0 || section >= sects || secDescs[section]->height == 0 || IsGraphics(section))
+        return 1;
+    struct Section *sec = secDescs[section];
+    int stored;
+    if(sec->fill < sec->height) {
+        stored = sec->fill++;
+        MarkDirty(section, stored, stored);
+    } else {
+        stored = sec->head;
+        if(++sec->head == sec->height)
+            sec->head = 0;
+        MarkDirty(section, 0, sec->height - 1);
+    }
+    cell_t *row = secCells[section] + stored * sec->width;
+    bool prop = sec->font->Format == FONT_FORMAT_PROP;
+    int i = 0, used = 0;
+    for(; i < sec->width && *txt != '\0' && *txt != '\n'; i++) {
+        uint32_t code;
+        txt += utf8_next(txt, &code);
+        row[i] = code_cell(sec->font, code, fallback);
+        if(prop && (used += cell_advance(sec->font, row[i]) * sec->scale) > canvasWidth)
+            break;
+    }
+    for(; i < sec->width; i++)
+        row[i] = CELL_EMPTY;
+    return 0;
+}
 
 /*
-Get a line from the indicated section; x is the line starting at base 0
+Add a shape to a graphics section: SHAPE_HLINE, SHAPE_VLINE, SHAPE_LINE, SHAPE_RECT, SHAPE_FILL
+or SHAPE_BAR, a gauge filled value/255 of the way across. x counts canvas pixels and y section rows,
+both clamped to the section. Only the rows the shape spans are marked dirty. Returns the shape's number for SetShape, -1 when the section is full or holds text
 */
-unsigned char *Screen::GetLineFromSection(int section, int x) {
-    // screen is exactly 15.25 bytes wide but screen expects to receive LINEBYTES bytes
-    unsigned char *line = (unsigned char *)calloc(LINEBYTES, 1);
-    sFONT *font = secDescs[section]->font;
-    uint8_t subln = x % font->Height;
-    int ln = x / font->Height;
+int Screen::AddShape(int section, uint8_t kind, int x0, int y0, int x1, int y1, uint8_t value) {
+    if(section < 0 || section >= sects || secDescs[section]->font != &graphicsRows || kind > SHAPE_BAR)
+        return -1;
+    struct Section *sec = secDescs[section];
+    if(sec->fill >= sec->width)
+        return -1;
+    StoreShape(section, (Shape *)secCells[section] + sec->fill, kind, x0, y0, x1, y1, value);
+    return sec->fill++;
+}
 
-    if(ln >= secDescs[section]->height) {
-        for(int i = 0; i < LINEBYTES; i++) 
-            line[i] = 0xFF;
-    } else {
-        uint8_t bytes = (font->Width / 8) + ((font->Width % 8) != 0);
-        const uint8_t **data = secPtrs[section];
-        line[0] = 0xFF; // avoid the cutoff
-        uint8_t wptr = 8;
-        unsigned char *cbyte = (unsigned char *)calloc(bytes,1);
-        for (uint8_t rptr = 0; rptr < secDescs[section]->width; rptr++)
-        {
-            const uint8_t *frame = data[ln * secDescs[section]->width + rptr];
-#ifdef UNIT
-            cbyte[0] = (unsigned char)frame;
-#else
-            for(uint8_t b = 0; b < bytes; b++) {
-                cbyte[b] = frame == nullptr ? 0xFF : ~pgm_read_byte(frame + bytes*subln + b);
-            }
-#endif
-            writebuf(cbyte, line, wptr, font->Width);
-            wptr += font->Width;
-        }
-        if(wptr < LINEBITS) {
-            for(ln = 0; ln < bytes; ln++)
-                cbyte[ln] = 0xFF;
-            writebuf(cbyte, line, wptr, LINEBITS-wptr);
+/* replace a shape, e.g. to move a gauge; the rows of both the old and the new shape are redrawn */
+int Screen::SetShape(int section, int shape, uint8_t kind, int x0, int y0, int x1, int y1, uint8_t value) {
+    if(section < 0 || section >= sects || secDescs[section]->font != &graphicsRows || kind > SHAPE_BAR
+            || shape < 0 || shape >= secDescs[section]->fill)
+        return 1;
+    Shape *sh = (Shape *)secCells[section] + shape;
+    MarkDirty(section, sh->y0 < sh->y1 ? sh->y0 : sh->y1, sh->y0 < sh->y1 ? sh->y1 : sh->y0);
+    StoreShape(section, sh, kind, x0, y0, x1, y1, value);
+    return 0;
+}
+
+/* empty a graphics section's display list */
+void Screen::ClearShapes(int section) {
+    if(section < 0 || section >= sects || secDescs[section]->font != &graphicsRows || secDescs[section]->fill == 0)
+        return;
+    secDescs[section]->fill = 0;
+    MarkDirty(section, 0, secDescs[section]->height - 1);
+}
+
+/* clamp and order a shape's points so rows can be rasterised without branching on direction:
+ x0 <= x1 for all but steep lines, which get y0 <= y1 instead and run one pixel per row */
+void Screen::StoreShape(int section, Shape *sh, uint8_t kind, int x0, int y0, int x1, int y1, uint8_t value) {
+    int right = canvasWidth - 1, bottom = secDescs[section]->height - 1;
+    x0 = x0 < 0 ? 0 : x0 > right ? right : x0;
+    x1 = x1 < 0 ? 0 : x1 > right ? right : x1;
+    y0 = y0 < 0 ? 0 : y0 > bottom ? bottom : y0;
+    y1 = y1 < 0 ? 0 : y1 > bottom ? bottom : y1;
+    if(kind == SHAPE_HLINE)
+        y1 = y0;
+    else if(kind == SHAPE_VLINE)
+        x1 = x0;
+    bool steep = kind == SHAPE_LINE && abs(y1 - y0) > abs(x1 - x0);
+    if(kind == SHAPE_LINE ? (steep ? y0 > y1 : x0 > x1) : x0 > x1) {
+        int t = x0; x0 = x1; x1 = t;
+        if(kind == SHAPE_LINE) {
+            t = y0; y0 = y1; y1 = t;
         }
-        free(cbyte);
     }
-    return line;
+    if(kind != SHAPE_LINE && y0 > y1) {
+        int t = y0; y0 = y1; y1 = t;
+    }
+    sh->kind = kind;
+    sh->x0 = x0;
+    sh->y0 = y0;
+    sh->x1 = x1;
+    sh->y1 = y1;
+    sh->value = value;
+    MarkDirty(section, y0 < y1 ? y0 : y1, y0 < y1 ? y1 : y0);
 }
 
-/* get line x of the screen */
-unsigned char * Screen::GetLine(int x) {
-    for(int s = 0; s < sects; s++) {
-        if(x < secDescs[s]->cap) {
-            int oft = s == 0 ? x : x - secDescs[s-1]->cap;
-            return GetLineFromSection(s, oft);
+/*
+Add a sample to a chart section, dropping the oldest once it is full. The range is kept as samples
+arrive: a sample outside it widens it, and the held samples are only rescanned when the one dropped
+was the lowest or highest. Plot rows are kept per sample and recomputed only when the range moves.
+The chart scrolls, so all its rows are redrawn. Values are clamped to 16 bits. Returns 1 for other sections
+*/
+int Screen::AddSample(int section, int value) {
+    if(section < 0 || section >= sects || secDescs[section]->font != &chartRows)
+        return 1;
+    struct Section *sec = secDescs[section];
+    ChartHeader *ch = (ChartHeader *)secCells[section];
+    int16_t *samples = (int16_t *)(ch + 1);
+    uint8_t *rows = (uint8_t *)(samples + sec->width);
+    value = value < INT16_MIN ? INT16_MIN : value > INT16_MAX ? INT16_MAX : value;
+    int at, lo = ch->lo, hi = ch->hi;
+    bool rescan = false;
+    if(sec->fill < sec->width) {
+        at = sec->head + sec->fill++;
+        if(at >= sec->width)
+            at -= sec->width;
+    } else {
+        at = sec->head;
+        rescan = samples[at] == lo || samples[at] == hi;
+        if(++sec->head == sec->width)
+            sec->head = 0;
+    }
+    samples[at] = value;
+    if(sec->fill == 1) {
+        lo = hi = value;
+    } else if(rescan) {
+        lo = hi = value;
+        for(int i = 0; i < sec->fill; i++) {
+            if(samples[i] < lo)
+                lo = samples[i];
+            if(samples[i] > hi)
+                hi = samples[i];
         }
+    } else {
+        if(value < lo)
+            lo = value;
+        if(value > hi)
+            hi = value;
     }
-    unsigned char *blank = (unsigned char *)malloc(LINEBYTES);
-    for(int i = 0; i < LINEBYTES; i++) {
-        blank[i] = 0xFF;
+    if(sec->fill == 1 || lo != ch->lo || hi != ch->hi) {
+        ch->lo = lo;
+        ch->hi = hi;
+        ChartRemap(section);
+    } else {
+        rows[at] = chart_row(value, lo, hi, sec->height);
     }
-    return blank;
+    MarkDirty(section, 0, sec->height - 1);
+    return 0;
 }
-#pragma endregion
 
-#pragma region EpdUtils
-#ifndef UNIT
-void Screen::SpiTransfer(unsigned char data) {
-    digitalWrite(CS_PIN, LOW);
-    SPI.transfer(data);
-    digitalWrite(CS_PIN, HIGH);
+/* the range of the samples a chart holds, e.g. to label its axis. Returns 1 when it holds none */
+int Screen::GetChartRange(int section, int *lo, int *hi) {
+    if(section < 0 || section >= sects || secDescs[section]->font != &chartRows || secDescs[section]->fill == 0)
+        return 1;
+    *lo = ((ChartHeader *)secCells[section])->lo;
+    *hi = ((ChartHeader *)secCells[section])->hi;
+    return 0;
 }
 
+/* drop every sample of a chart section */
+void Screen::ClearSamples(int section) {
+    if(section < 0 || section >= sects || secDescs[section]->font != &chartRows || secDescs[section]->fill == 0)
+        return;
+    secDescs[section]->head = 0;
+    secDescs[section]->fill = 0;
+    MarkDirty(section, 0, secDescs[section]->height - 1);
+}
 
-/**
- *  @brief: basic function for sending commands
- */
-void Screen::SendCommand(unsigned char command)
-{
-    digitalWrite(DC_PIN, LOW);
-    SpiTransfer(command);
+/* recompute the plot row of every sample after the range moved */
+void Screen::ChartRemap(int section) {
+    struct Section *sec = secDescs[section];
+    ChartHeader *ch = (ChartHeader *)secCells[section];
+    int16_t *samples = (int16_t *)(ch + 1);
+    uint8_t *rows = (uint8_t *)(samples + sec->width);
+    for(int i = 0; i < sec->fill; i++)
+        rows[i] = chart_row(samples[i], ch->lo, ch->hi, sec->height);
 }
 
-/**
+// ImageStream state: the PBM header fields in order, then the pixel rows
+#define IMAGE_MAGIC 0
+#define IMAGE_WIDTH 2
+#define IMAGE_HEIGHT 3
+#define IMAGE_BODY 4
+#define IMAGE_FIELD 0x0F
+#define IMAGE_DIGITS 0x40  // the field has digits
+#define IMAGE_COMMENT 0x80 // skipping a # comment to the end of the line
+#define IMAGE_REFUSED IMAGE_FIELD
+
+/*
+Open image section section for a picture in format (IMAGE_RAW or IMAGE_PBM) and point the panel's
+RAM window at its rows. The bytes then go to PushImage as they arrive and each row is written
+to the panel as soon as it is complete, so only one row is ever held. Nothing else may use the
+panel until EndImage. Returns 1 if the section is not an image, another image is open or the
+panel is still busy (check Poll() first).
+*/
+int Screen::BeginImage(int section, uint8_t format) {
+    if(section < 0 || section >= sects || secDescs[section]->font != &imageRows || format > IMAGE_PBM
+        || stream.section >= 0 || rotation != ROTATE_0)
+        return 1;
+    if(!Poll())
+        return 1;
+    struct Section *sec = secDescs[section];
+    int top = section == 0 ? 0 : secDescs[section - 1]->cap;
+    stream.section = section;
+    stream.rows = sec->height;
+    stream.row = 0;
+    stream.number = 0;
+    stream.state = format == IMAGE_PBM ? IMAGE_MAGIC : IMAGE_BODY;
+    stream.at = 0;
+    SetWindow(top, top + sec->height - 1);
+    SendCommand(0x24);
+    return 0;
+}
+
+/*
+Feed the next len bytes of the open image. Rows past the bottom of the section are dropped.
+Returns the bytes the image still needs, 0 once it is complete, or -1 when no image is open
+or its PBM header is not a P4 image EPD_WIDTH pixels wide (the rest of the image is then ignored).
+*/
+int Screen::PushImage(const uint8_t *data, size_t len) {
+    if(stream.section < 0 || stream.state == IMAGE_REFUSED)
+        return -1;
+    for(size_t i = 0; i < len; i++) {
+        if(stream.state != IMAGE_BODY) {
+            if(ImageHeader(data[i])) {
+                stream.state = IMAGE_REFUSED;
+                return -1;
+            }
+            continue;
+        }
+        if(stream.row >= stream.rows)
+            break;
+        stream.line[stream.at++] = data[i];
+        if(stream.at == LINEBYTES)
+            SendImageRow();
+    }
+    if(stream.state != IMAGE_BODY)
+        return 1 + stream.rows * LINEBYTES; // at least the rows of the section
+    return (stream.rows - stream.row) * LINEBYTES - stream.at;
+}
+
+/* take one byte of a PBM header, returns 1 if it is not one this section can show */
+int Screen::ImageHeader(uint8_t c) {
+    uint8_t field = stream.state & IMAGE_FIELD;
+    if(stream.state & IMAGE_COMMENT) {
+        if(c == '\n' || c == '\r')
+            stream.state &= ~IMAGE_COMMENT;
+        return 0;
+    }
+    if(field < IMAGE_WIDTH) {
+        if(c != (field == IMAGE_MAGIC ? 'P' : '4'))
+            return 1;
+        stream.state++;
+        return 0;
+    }
+    if(c >= '0' && c <= '9') {
+        if(stream.number > 999)
+            return 1;
+        stream.number = stream.number * 10 + c - '0';
+        stream.state |= IMAGE_DIGITS;
+        return 0;
+    }
+    if(c != ' ' && c != '\t' && c != '\n' && c != '\r' && c != '#')
+        return 1;
+    if(stream.state & IMAGE_DIGITS) {
+        // a field ends on the first white space after it, the pixels start right after the height's
+        if(field == IMAGE_WIDTH) {
+            if(stream.number != EPD_WIDTH)
+                return 1;
+            stream.state = IMAGE_HEIGHT;
+        } else {
+            stream.rows = stream.number;
+            stream.state = IMAGE_BODY;
+            return 0;
+        }
+        stream.number = 0;
+    }
+    if(c == '#')
+        stream.state |= IMAGE_COMMENT;
+    return 0;
+}
+
+/*
+Close the open image, leaving rows it did not cover blank. The rows are shown by the next Draw
+or DrawAsync together with any other changes. Returns 1 when no image is open.
+*/
+int Screen::EndImage() {
+    if(stream.section < 0)
+        return 1;
+    struct Section *sec = secDescs[stream.section];
+    if(stream.at > 0) {
+        memset(stream.line + stream.at, 0, LINEBYTES - stream.at);
+        SendImageRow();
+    }
+    memset(stream.line, 0, LINEBYTES);
+    while(stream.row < sec->height)
+        SendImageRow();
+    sec->dirtyFirst = -1; // the panel holds the picture, nothing to compose
+    sec->dirtyLast = -1;
+    int top = stream.section == 0 ? 0 : secDescs[stream.section - 1]->cap;
+    if(top < imageFirst)
+        imageFirst = top;
+    if(sec->cap - 1 > imageLast)
+        imageLast = sec->cap - 1;
+    stream.section = -1;
+    return 0;
+}
+
+/* code point drawn in place of characters a font has no glyph for, '?' by default */
+void Screen::SetFallback(uint32_t code) {
+    fallback = code;
+}
+
+/* Print and AddText lay out a section from the top, so drop any ring rotation first */
+void Screen::ResetRing(int section) {
+    struct Section *sec = secDescs[section];
+    sec->fill = sec->height;
+    if(sec->head != 0) {
+        sec->head = 0;
+        MarkDirty(section, 0, sec->height - 1);
+    }
+}
+
+#pragma endregion
+
+#pragma region Output
+
+/*
+Compose a line from the indicated section into line (canvasBytes long); x is the line starting at base 0.
+Composed lines hold ink bits (1 = black), see RenderLine for panel polarity
+*/
+void Screen::ComposeLineFromSection(int section, int x, unsigned char *line) {
+    int lineRows = secDescs[section]->font->Height * secDescs[section]->scale;
+    ComposeGlyphLine(section, x / lineRows, x % lineRows, line);
+}
+
+/* compose row subln of glyph line ln of a section; subln counts panel rows, so scaled sections repeat each glyph row */
+void Screen::ComposeGlyphLine(int section, int ln, uint8_t subln, unsigned char *line) {
+    sFONT *font = secDescs[section]->font;
+    if(font->table == nullptr) {
+        if(font == &graphicsRows)
+            ComposeShapeLine(section, ln, line);
+        else if(font == &chartRows)
+            ComposeChartLine(section, ln, line);
+        else // image pixels are only in the panel, blank until one is streamed
+            memset(line, 0, canvasBytes);
+        return;
+    }
+    uint8_t scale = secDescs[section]->scale;
+    if(scale > 1)
+        subln = scale == 2 ? subln >> 1 : subln / scale;
+    // screen is exactly 15.25 bytes wide but expects to receive LINEBYTES bytes, the LINEPAD cutoff stays blank.
+    // Landscape canvas rows are 250 pixels in 32 bytes, with the same cutoff
+    memset(line, 0, canvasBytes);
+    if(ln >= secDescs[section]->height)
+        return;
+    uint8_t width = secDescs[section]->width;
+    int stored = ln + secDescs[section]->head; // glyph line ln counts from the ring head
+    if(stored >= secDescs[section]->height)
+        stored -= secDescs[section]->height;
+    const cell_t *cells = secCells[section] + stored * width;
+    const uint8_t *table = font->table;
+    unsigned int glyphBytes = font_glyph_bytes(font);
+    bool packed = font->Format == FONT_FORMAT_PACKED;
+    Blitter b;
+    blit_begin(&b, line, canvasBytes * 8 - canvasWidth);
+    if(font->Format == FONT_FORMAT_PROP) {
+        // glyphs packed at their own advance, cut off at the first one past the panel edge
+        unsigned int x = 0;
+        for(uint8_t i = 0; i < width; i++) {
+            if(cells[i] == CELL_EMPTY)
+                continue;
+            unsigned int g = cells[i] - 1;
+            uint8_t advance = pgm_read_byte(&font->Widths[g]);
+            if(x + advance * scale > (unsigned int)canvasWidth)
+                break;
+            const uint8_t *glyph = table + pgm_read_word(&font->Offsets[g]);
+            uint32_t row = glyph_row(glyph, advance, subln, true);
+            if(scale > 1)
+                blit_scaled(&b, row, advance, scale);
+            else
+                blit_push(&b, row, advance);
+            x += advance * scale;
+        }
+    } else if(scale > 1) {
+        // rows are decoded at font size and widened as they are pushed
+        for(uint8_t i = 0; i < width; i++) {
+            const uint8_t *glyph = cell_glyph(table, cells[i], glyphBytes);
+            uint32_t row = glyph_row(glyph, font->Width, subln, packed);
+            blit_scaled(&b, row, font->Width, scale);
+        }
+    } else if(packed) {
+        switch(font->Width) {
+            case 5: blit_glyphs_w<5, true>(&b, cells, width, table, glyphBytes, subln); break;
+            case 7: blit_glyphs_w<7, true>(&b, cells, width, table, glyphBytes, subln); break;
+            case 11: blit_glyphs_w<11, true>(&b, cells, width, table, glyphBytes, subln); break;
+            case 14: blit_glyphs_w<14, true>(&b, cells, width, table, glyphBytes, subln); break;
+            case 17: blit_glyphs_w<17, true>(&b, cells, width, table, glyphBytes, subln); break;
+            default: blit_glyphs(&b, cells, width, table, glyphBytes, font->Width, subln, true); break;
+        }
+    } else {
+        switch(font->Width) {
+            case 5: blit_glyphs_w<5, false>(&b, cells, width, table, glyphBytes, subln); break;
+            case 7: blit_glyphs_w<7, false>(&b, cells, width, table, glyphBytes, subln); break;
+            case 11: blit_glyphs_w<11, false>(&b, cells, width, table, glyphBytes, subln); break;
+            case 14: blit_glyphs_w<14, false>(&b, cells, width, table, glyphBytes, subln); break;
+            case 17: blit_glyphs_w<17, false>(&b, cells, width, table, glyphBytes, subln); break;
+            default: blit_glyphs(&b, cells, width, table, glyphBytes, font->Width, subln, false); break;
+        }
+    }
+    blit_end(&b);
+}
+
+/* rasterise row y of a graphics section: the runs of every shape crossing it */
+void Screen::ComposeShapeLine(int section, int y, unsigned char *line) {
+    memset(line, 0, canvasBytes);
+    const Shape *sh = (const Shape *)secCells[section];
+    int pad = canvasBytes * 8 - canvasWidth;
+    int16_t run[4];
+    for(int i = secDescs[section]->fill; i > 0; i--, sh++) {
+        uint8_t n = shape_runs(sh, y, run);
+        for(uint8_t r = 0; r < n; r++)
+            line_run(line, pad + run[2 * r], pad + run[2 * r + 1]);
+    }
+}
+
+/* canvas pixels [x0, x0 + 8) of row y of a graphics section, see GlyphByte */
+uint8_t Screen::ShapeByte(int section, int y, int x0) {
+    const Shape *sh = (const Shape *)secCells[section];
+    int16_t run[4];
+    uint8_t bits = 0;
+    for(int i = secDescs[section]->fill; i > 0; i--, sh++) {
+        uint8_t n = shape_runs(sh, y, run);
+        for(uint8_t r = 0; r < n; r++) {
+            int first = run[2 * r] - x0, last = run[2 * r + 1] - x0;
+            if(last < 0 || first > 7)
+                continue;
+            bits |= (uint8_t)(0xFF >> (first < 0 ? 0 : first)) & (uint8_t)(0xFF << (last > 7 ? 0 : 7 - last));
+        }
+    }
+    return bits;
+}
+
+/* rasterise row y of a chart section: a bit per sample, the oldest fill columns from the right edge */
+void Screen::ComposeChartLine(int section, int y, unsigned char *line) {
+    memset(line, 0, canvasBytes);
+    struct Section *sec = secDescs[section];
+    if(sec->fill == 0)
+        return;
+    ChartHeader *ch = (ChartHeader *)secCells[section];
+    const uint8_t *rows = (const uint8_t *)((int16_t *)(ch + 1) + sec->width);
+    Blitter b;
+    blit_begin(&b, line, canvasBytes * 8 - sec->fill);
+    int at = sec->head;
+    uint8_t prev = rows[at], bits = 0, n = 0;
+    for(int i = sec->fill; i > 0; i--) {
+        uint8_t cur = rows[at];
+        bits = (bits << 1) | chart_pixel(ch->style, prev, cur, y);
+        if(++n == 8) {
+            blit_push(&b, bits, 8);
+            n = 0;
+        }
+        prev = cur;
+        if(++at == sec->width)
+            at = 0;
+    }
+    blit_push(&b, bits & ((1 << n) - 1), n);
+    blit_end(&b);
+}
+
+/* canvas pixels [x0, x0 + 8) of row y of a chart section, see GlyphByte */
+uint8_t Screen::ChartByte(int section, int y, int x0) {
+    struct Section *sec = secDescs[section];
+    ChartHeader *ch = (ChartHeader *)secCells[section];
+    const uint8_t *rows = (const uint8_t *)((int16_t *)(ch + 1) + sec->width);
+    int oldest = canvasWidth - sec->fill; // column of the oldest sample
+    uint8_t bits = 0;
+    for(int x = x0; x < x0 + 8; x++) {
+        int i = x - oldest;
+        if(i < 0 || i >= sec->fill)
+            continue;
+        int at = sec->head + i;
+        at -= at >= sec->width ? sec->width : 0;
+        int before = i == 0 ? at : at == 0 ? sec->width - 1 : at - 1;
+        bits |= chart_pixel(ch->style, rows[before], rows[at], y) << (7 - (x - x0));
+    }
+    return bits;
+}
+
+/*
+Bits [x0, x0 + 8) of row subln of glyph line ln of a section, MSB first; pixels off the canvas are blank.
+Only the glyphs under the window are decoded, which is what lets landscape screens be sent a column
+of the canvas at a time without composing whole rows
+*/
+uint8_t Screen::GlyphByte(int section, int ln, uint8_t subln, int x0) {
+    struct Section *sec = secDescs[section];
+    if(ln >= sec->height || x0 >= canvasWidth)
+        return 0;
+    if(sec->font == &graphicsRows)
+        return ShapeByte(section, ln, x0);
+    if(sec->font == &chartRows)
+        return ChartByte(section, ln, x0);
+    if(sec->font == &imageRows)
+        return 0;
+    sFONT *font = sec->font;
+    uint8_t scale = sec->scale;
+    if(scale > 1)
+        subln = scale == 2 ? subln >> 1 : subln / scale;
+    int stored = ln + sec->head;
+    if(stored >= sec->height)
+        stored -= sec->height;
+    const cell_t *cells = secCells[section] + stored * sec->width;
+    bool prop = font->Format == FONT_FORMAT_PROP;
+    bool packed = prop || font->Format == FONT_FORMAT_PACKED;
+    unsigned int glyphBytes = prop ? 0 : font_glyph_bytes(font);
+    // find the first glyph reaching into the window, then push glyphs until it is covered
+    int i = 0, x = 0;
+    if(!prop) {
+        int pitch = font->Width * scale;
+        i = x0 > 0 ? x0 / pitch : 0;
+        x = i * pitch;
+    }
+    unsigned char win[21]; // 8 blank bits, the glyph under x0 (< 72 bits before it) and glyphs to x0 + 8 (< 80 more)
+    memset(win, 0, sizeof(win));
+    Blitter b;
+    blit_begin(&b, win, 8);
+    int start = x;
+    for(; i < sec->width && x < x0 + 8; i++) {
+        const uint8_t *glyph;
+        uint8_t w;
+        if(prop) {
+            if(cells[i] == CELL_EMPTY)
+                continue;
+            unsigned int g = cells[i] - 1;
+            w = pgm_read_byte(&font->Widths[g]);
+            if(x + w * scale > canvasWidth)
+                break;
+            if(x + w * scale <= x0) { // left of the window, skipped without decoding
+                x += w * scale;
+                start = x;
+                continue;
+            }
+            glyph = font->table + pgm_read_word(&font->Offsets[g]);
+        } else {
+            w = font->Width;
+            glyph = cell_glyph(font->table, cells[i], glyphBytes);
+        }
+        uint32_t row = glyph_row(glyph, w, subln, packed);
+        if(scale > 1)
+            blit_scaled(&b, row, w, scale);
+        else
+            blit_push(&b, row, w);
+        x += w * scale;
+    }
+    blit_end(&b);
+    if(x <= x0) // the line ends before the window
+        return 0;
+    int o = x0 - start + 8; // window position in win, >= 1
+    return (uint8_t)(win[o / 8] << (o % 8)) | (uint8_t)(win[o / 8 + 1] >> (8 - o % 8));
+}
+
+/*
+Panel rows [first, first + 8) of a landscape screen, first a multiple of 8. Those rows are 8 columns
+of the canvas, so each canvas row gives one byte; every 8 canvas rows make an 8x8 block, transposed
+into one byte of each of the 8 panel rows. Nothing larger than the band is held
+*/
+void Screen::ComposeBand(int first, unsigned char band[8][LINEBYTES]) {
+    bool cw = rotation == ROTATE_90; // canvas row y lands on panel column EPD_WIDTH - 1 - y, else on column y
+    int x0 = cw ? first : EPD_HEIGHT - 8 - first; // canvas columns of the band
+    uint8_t block[8], cols[8];
+    memset(band, 0, 8 * LINEBYTES);
+    RowCursor at;
+    SeekRow(0, &at);
+    int k = -1;
+    for(int y = 0; y < canvasHeight; y++) {
+        int bit = LINEPAD + (cw ? EPD_WIDTH - 1 - y : y); // panel bit the row lands on
+        if(bit / 8 != k) {
+            if(k >= 0) {
+                transpose8(block, cols);
+                for(int r = 0; r < 8; r++)
+                    band[cw ? r : 7 - r][k] = cols[r];
+            }
+            k = bit / 8;
+            memset(block, 0, sizeof(block));
+        }
+        if(at.section < sects)
+            block[bit % 8] = GlyphByte(at.section, at.line, at.subrow, x0);
+        StepRow(&at);
+    }
+    transpose8(block, cols);
+    for(int r = 0; r < 8; r++)
+        band[cw ? r : 7 - r][k] = cols[r];
+}
+
+/* compose panel row x in ink polarity into line, a caller-owned buffer of LINEBYTES bytes.
+ Rotated screens are mapped back onto the canvas here; in landscape this composes the row's whole band, SendRows keeps bands */
+void Screen::ComposeLine(int x, unsigned char *line) {
+    if(rotation == ROTATE_0) {
+        ComposeCanvasLine(x, line);
+    } else if(rotation == ROTATE_180) {
+        unsigned char l[LINEBYTES];
+        ComposeCanvasLine(EPD_HEIGHT - 1 - x, l);
+        line_mirror(l, line);
+    } else if(x >= 0 && x < EPD_HEIGHT) {
+        unsigned char band[8][LINEBYTES];
+        ComposeBand(x - x % 8, band);
+        memcpy(line, band[x % 8], LINEBYTES);
+    } else {
+        memset(line, 0, LINEBYTES);
+    }
+}
+
+/* compose row y of the canvas, the sections unrotated, into line (canvasBytes long) */
+void Screen::ComposeCanvasLine(int y, unsigned char *line) {
+    if(rowMap != nullptr && y >= 0 && y < EPD_HEIGHT) {
+        uint8_t section = pgm_read_byte(&rowMap[y].section);
+        if(section == LAYOUT_BLANK)
+            memset(line, 0, LINEBYTES);
+        else
+            ComposeGlyphLine(section, pgm_read_byte(&rowMap[y].line), pgm_read_byte(&rowMap[y].subrow), line);
+        return;
+    }
+    for(int s = 0; s < sects; s++) {
+        if(y < secDescs[s]->cap) {
+            int oft = s == 0 ? y : y - secDescs[s-1]->cap;
+            ComposeLineFromSection(s, oft, line);
+            return;
+        }
+    }
+    memset(line, 0, canvasBytes);
+}
+
+/* point a cursor at canvas row x (the panel row unless rotated); the one place a row is divided into glyph line and sub-row */
+void Screen::SeekRow(int x, RowCursor *at) {
+    if(rowMap != nullptr && x >= 0 && x < EPD_HEIGHT) {
+        uint8_t section = pgm_read_byte(&rowMap[x].section);
+        at->section = section == LAYOUT_BLANK ? sects : section;
+        at->line = pgm_read_byte(&rowMap[x].line);
+        at->subrow = pgm_read_byte(&rowMap[x].subrow);
+        return;
+    }
+    at->section = sects;
+    at->line = 0;
+    at->subrow = 0;
+    for(int s = 0; s < sects; s++) {
+        if(x < secDescs[s]->cap) {
+            int oft = s == 0 ? x : x - secDescs[s-1]->cap;
+            int lineRows = secDescs[s]->font->Height * secDescs[s]->scale;
+            at->section = s;
+            at->line = oft / lineRows;
+            at->subrow = oft % lineRows;
+            return;
+        }
+    }
+}
+
+/* compose the canvas row at the cursor into line, a buffer of len bytes, then step the cursor to the next row.
+ A landscape canvas row takes CANVASBYTES; returns 1, leaving the cursor, when line is too short */
+int Screen::ComposeNext(RowCursor *at, unsigned char *line, size_t len) {
+    if(len < canvasBytes)
+        return 1;
+    if(at->section >= sects) {
+        memset(line, 0, canvasBytes);
+        return 0;
+    }
+    ComposeGlyphLine(at->section, at->line, at->subrow, line);
+    StepRow(at);
+    return 0;
+}
+
+/* move a cursor down one canvas row */
+void Screen::StepRow(RowCursor *at) {
+    if(at->section >= sects)
+        return;
+    struct Section *sec = secDescs[at->section];
+    if(++at->subrow < sec->font->Height * sec->scale)
+        return;
+    at->subrow = 0;
+    if(++at->line < sec->height)
+        return;
+    at->line = 0;
+    do {
+        at->section++;
+    } while(at->section < sects && secDescs[at->section]->height == 0);
+}
+
+/* render line x of the screen in panel polarity (1 = white) into line, a caller-owned buffer of LINEBYTES bytes */
+void Screen::RenderLine(int x, unsigned char *line) {
+    ComposeLine(x, line);
+    for(int i = 0; i < LINEBYTES; i++)
+        line[i] = ~line[i];
+}
+
+/* get line x of the screen; the caller frees the returned buffer. Prefer RenderLine */
+unsigned char * Screen::GetLine(int x) {
+    unsigned char *line = (unsigned char *)malloc(LINEBYTES);
+    RenderLine(x, line);
+    return line;
+}
+#pragma endregion
+
+#pragma region EpdUtils
+
+const unsigned char lut_full_update[] PROGMEM = {
+    0x80,0x60,0x40,0x00,0x00,0x00,0x00,             //LUT0: BB:     VS 0 ~7
+    0x10,0x60,0x20,0x00,0x00,0x00,0x00,             //LUT1: BW:     VS 0 ~7
+    0x80,0x60,0x40,0x00,0x00,0x00,0x00,             //LUT2: WB:     VS 0 ~7
+    0x10,0x60,0x20,0x00,0x00,0x00,0x00,             //LUT3: WW:     VS 0 ~7
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,             //LUT4: VCOM:   VS 0 ~7
+
+    0x03,0x03,0x00,0x00,0x02,                       // TP0 A~D RP0
+    0x09,0x09,0x00,0x00,0x02,                       // TP1 A~D RP1
+    0x03,0x03,0x00,0x00,0x02,                       // TP2 A~D RP2
+    0x00,0x00,0x00,0x00,0x00,                       // TP3 A~D RP3
+    0x00,0x00,0x00,0x00,0x00,                       // TP4 A~D RP4
+    0x00,0x00,0x00,0x00,0x00,                       // TP5 A~D RP5
+    0x00,0x00,0x00,0x00,0x00,                       // TP6 A~D RP6
+
+    0x15,0x41,0xA8,0x32,0x30,0x0A,
+};
+
+const unsigned char lut_partial_update[] PROGMEM = {
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,             //LUT0: BB:     VS 0 ~7
+    0x80,0x00,0x00,0x00,0x00,0x00,0x00,             //LUT1: BW:     VS 0 ~7
+    0x40,0x00,0x00,0x00,0x00,0x00,0x00,             //LUT2: WB:     VS 0 ~7
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,             //LUT3: WW:     VS 0 ~7
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,             //LUT4: VCOM:   VS 0 ~7
+
+    0x0A,0x00,0x00,0x00,0x00,                       // TP0 A~D RP0
+    0x00,0x00,0x00,0x00,0x00,                       // TP1 A~D RP1
+    0x00,0x00,0x00,0x00,0x00,                       // TP2 A~D RP2
+    0x00,0x00,0x00,0x00,0x00,                       // TP3 A~D RP3
+    0x00,0x00,0x00,0x00,0x00,                       // TP4 A~D RP4
+    0x00,0x00,0x00,0x00,0x00,                       // TP5 A~D RP5
+    0x00,0x00,0x00,0x00,0x00,                       // TP6 A~D RP6
+
+    0x15,0x41,0xA8,0x32,0x30,0x0A,
+};
+
+/* the full waveform with each phase run once instead of three times */
+const unsigned char lut_fast_update[] PROGMEM = {
+    0x80,0x60,0x40,0x00,0x00,0x00,0x00,             //LUT0: BB:     VS 0 ~7
+    0x10,0x60,0x20,0x00,0x00,0x00,0x00,             //LUT1: BW:     VS 0 ~7
+    0x80,0x60,0x40,0x00,0x00,0x00,0x00,             //LUT2: WB:     VS 0 ~7
+    0x10,0x60,0x20,0x00,0x00,0x00,0x00,             //LUT3: WW:     VS 0 ~7
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,             //LUT4: VCOM:   VS 0 ~7
+
+    0x03,0x03,0x00,0x00,0x00,                       // TP0 A~D RP0
+    0x09,0x09,0x00,0x00,0x00,                       // TP1 A~D RP1
+    0x03,0x03,0x00,0x00,0x00,                       // TP2 A~D RP2
+    0x00,0x00,0x00,0x00,0x00,                       // TP3 A~D RP3
+    0x00,0x00,0x00,0x00,0x00,                       // TP4 A~D RP4
+    0x00,0x00,0x00,0x00,0x00,                       // TP5 A~D RP5
+    0x00,0x00,0x00,0x00,0x00,                       // TP6 A~D RP6
+
+    0x15,0x41,0xA8,0x32,0x30,0x0A,
+};
+
+/**
+ *  @brief: basic function for sending commands
+ */
+void Screen::SendCommand(unsigned char command)
+{
+    epd->Command(command);
+}
+
+/**
  *  @brief: basic function for sending data
  */
 void Screen::SendData(unsigned char data)
 {
-    digitalWrite(DC_PIN, HIGH);
-    SpiTransfer(data);
+    epd->Data(data);
 }
 
 /**
- *  @brief: Wait until the BUSY_PIN goes HIGH
+ *  @brief: send a run of data bytes in a single transfer
  */
-void Screen::WaitUntilIdle(void)
+void Screen::SendDataBlock(const uint8_t *data, size_t len)
 {
-    while (digitalRead(BUSY_PIN) == 1)
-    { //LOW: idle, HIGH: busy
-        delay(100);
-    }
-    delay(200);
+    epd->DataBlock(data, len);
 }
 
-int Screen::EpdInit()
+/* bytes, chip-select assertions and bus time used so far */
+const EpdTransferStats *Screen::GetTransferStats()
+{
+    return &epd->transfer;
+}
+
+/**
+ *  @brief: note the start of a controller operation that raises the busy line
+ */
+void Screen::BusyStart()
+{
+    busyPending = true;
+    busySeen = false;
+    busyStart = epd->Millis();
+}
+
+/**
+ *  @brief: kick off the update sequence selected by mode (0x22) without waiting
+ */
+void Screen::Activate(unsigned char mode)
 {
-    /* this calls the peripheral hardware interface, see epdif */
-    pinMode(CS_PIN, OUTPUT);
-    pinMode(RST_PIN, OUTPUT);
-    pinMode(DC_PIN, OUTPUT);
-    pinMode(BUSY_PIN, INPUT);
+    SendCommand(0x22);
+    SendData(mode);
+    SendCommand(0x20);
+    BusyStart();
+}
 
-    SPI.begin();
-    SPI.beginTransaction(SPISettings(2000000, MSBFIRST, SPI_MODE0));
+/**
+ *  @brief: true once the panel is idle and ready for DrawAsync. An operation
+ *          is over when the busy line has risen and fallen again, or never
+ *          rose within EPD_BUSY_RISE_MS. Loads the partial LUT after a full
+ *          refresh, which keeps the panel busy a little longer.
+ */
+bool Screen::Poll()
+{
+    if (busyPending)
+    {
+        if (epd->Busy())
+        {
+            busySeen = true;
+            return false;
+        }
+        if (!busySeen && epd->Millis() - busyStart < EPD_BUSY_RISE_MS)
+            return false;
+        busyPending = false;
+        if (lutPending)
+        {
+            lutPending = false;
+            SetLut(REFRESH_PARTIAL);
+            return false;
+        }
+    }
+    return !epd->Busy();
+}
 
-    Reset();
+/**
+ *  @brief: Wait until the busy line drops
+ */
+void Screen::WaitUntilIdle(void)
+{
+    while (!Poll())
+    {
+        epd->Delay(EPD_POLL_MS);
+    }
+}
 
+/**
+ *  @brief: pulse reset and set the controller up. A hardware reset returns
+ *          every register to its power-on default and drops the loaded LUT
+ */
+int Screen::EpdInit()
+{
     int count;
 
+    lut = REFRESH_NONE;
+    lutPending = false;
+    busyPending = false;
+    epd->Reset();
+
     WaitUntilIdle();
     SendCommand(0x12); // soft reset
+    BusyStart();
     WaitUntilIdle();
 
     SendCommand(0x74); //set analog block control
@@ -331,22 +1693,28 @@ int Screen::EpdInit()
     SendData(0x55);    //
 
     SendCommand(0x03);
-    SendData(lut_full_update[70]);
+    SendData(pgm_read_byte(&lut_full_update[70]));
 
     SendCommand(0x04); //
-    SendData(lut_full_update[71]);
-    SendData(lut_full_update[72]);
-    SendData(lut_full_update[73]);
+    SendData(pgm_read_byte(&lut_full_update[71]));
+    SendData(pgm_read_byte(&lut_full_update[72]));
+    SendData(pgm_read_byte(&lut_full_update[73]));
 
     SendCommand(0x3A); //Dummy Line
-    SendData(lut_full_update[74]);
+    SendData(pgm_read_byte(&lut_full_update[74]));
     SendCommand(0x3B); //Gate time
-    SendData(lut_full_update[75]);
+    SendData(pgm_read_byte(&lut_full_update[75]));
 
     SendCommand(0x32);
     for (count = 0; count < 70; count++)
     {
-        SendData(lut_full_update[count]);
+        SendData(pgm_read_byte(&lut_full_update[count]));
+    }
+
+    SendCommand(0x37); // ping-pong for Display Mode 2, see SetLut
+    for (count = 0; count < 7; count++)
+    {
+        SendData(count == 4 ? 0x40 : 0x00);
     }
 
     SendCommand(0x4E); // set RAM x address count to 0;
@@ -355,6 +1723,7 @@ int Screen::EpdInit()
     SendData(0xF9);
     SendData(0x00);
     WaitUntilIdle();
+    lut = REFRESH_FULL;
 
     return 0;
 }
@@ -362,37 +1731,14 @@ int Screen::EpdInit()
 /**
  *  @brief: module reset.
  *          often used to awaken the module in deep sleep,
- *          see Epd::Sleep();
+ *          see Epd::Sleep(); the controller is set up again
+ *          and the next draw is a full refresh
  */
 void Screen::Reset(void)
 {
-    digitalWrite(RST_PIN, HIGH);
-    delay(200);
-    digitalWrite(RST_PIN, LOW); //module reset
-    delay(10);
-    digitalWrite(RST_PIN, HIGH);
-    delay(200);
-}
-
-void Screen::Clear()
-{
-    int w, h;
-    w = (EPD_WIDTH % 8 == 0) ? (EPD_WIDTH / 8) : (EPD_WIDTH / 8 + 1);
-    h = EPD_HEIGHT;
-    SendCommand(0x24);
-    for (int j = 0; j < h; j++)
-    {
-        for (int i = 0; i < w; i++)
-        {
-            SendData(0xFF);
-        }
-    }
-
-    //DISPLAY REFRESH
-    SendCommand(0x22);
-    SendData(0xC7);
-    SendCommand(0x20);
-    WaitUntilIdle();
+    EpdInit();
+    fullPending = true;
+    stream.section = -1;
 }
 
 /**
@@ -405,62 +1751,428 @@ void Screen::Clear()
  */
 void Screen::Sleep()
 {
+    WaitUntilIdle();
     SendCommand(0x22); //POWER OFF
     SendData(0xC3);
     SendCommand(0x20);
 
     SendCommand(0x10); //enter deep sleep
     SendData(0x01);
-    delay(200);
+    epd->Delay(200);
 
-    digitalWrite(RST_PIN, LOW);
+    epd->PowerDown();
+    fullPending = true;
+    stream.section = -1;
 }
-void Screen::Draw()
+
+/**
+ *  @brief: load the waveform LUT for a REFRESH_ kind. Refreshes run in display
+ *          mode 2, which picks a pixel's waveform by its previous (RAM 0x26) and
+ *          new (0x24) value: the partial LUT only drives pixels that differ, while
+ *          the fast and full LUTs drive every pixel the same whatever it was
+ *          (LUT0 = LUT2, LUT1 = LUT3). The ping-pong option then copies 0x24 into
+ *          0x26 after each refresh, rows the MCU never rewrites included
+ */
+void Screen::SetLut(uint8_t kind)
 {
-    SendCommand(0x24);
-    for (int line = 0; line < EPD_HEIGHT; line++)
+    bool partial = kind == REFRESH_PARTIAL;
+    const unsigned char *table = partial ? lut_partial_update : kind == REFRESH_FAST ? lut_fast_update : lut_full_update;
+
+    SendCommand(0x2C); //VCOM Voltage
+    SendData(partial ? 0x26 : 0x55);
+
+    SendCommand(0x32);
+    for (int count = 0; count < 70; count++)
     {
-        unsigned char *l = GetLine(line);
-        for (int h = 15; h >= 0; h--)
-        {
-            SendData(rev_byte(l[h]));
-        }
-        free(l);
+        SendData(pgm_read_byte(&table[count]));
     }
 
-    //DISPLAY REFRESH
-    SendCommand(0x22);
-    SendData(0xC7);
-    SendCommand(0x20);
-    WaitUntilIdle();
+    SendCommand(0x37); // ping-pong for Display Mode 2
+    for (int count = 0; count < 7; count++)
+    {
+        SendData(count == 4 ? 0x40 : 0x00);
+    }
+
+    SendCommand(0x3C); //BorderWavefrom
+    SendData(partial ? 0x01 : 0x03);
+    lut = kind;
+
+    if (partial)
+        Activate(0xC0); // power on, completes in the background
 }
-#endif
 
-#pragma endregion
+/**
+ *  @brief: restrict RAM writes to panel rows [first, last] and move the
+ *          address counter to the start of that window. Y counts down
+ *          (data entry mode 0x01), so row 0 is RAM address 0xF9
+ */
+void Screen::SetWindow(int first, int last)
+{
+    SendCommand(0x44); //set Ram-X address start/end position
+    SendData(0x00);
+    SendData(0x0F);
 
-#pragma region UnitTesting
+    SendCommand(0x45); //set Ram-Y address start/end position
+    SendData(0xF9 - first);
+    SendData(0x00);
+    SendData(0xF9 - last);
+    SendData(0x00);
 
-#ifdef UNIT
-void Screen::Print() {
-    const uint8_t **data;
-    for(int s = 0; s < sects; s++) {
-        printf("W %d H %d C %d\n", secDescs[s]->width, secDescs[s]->height, secDescs[s]->cap);
-        data = secPtrs[s];
-        int w = secDescs[s]->width;
-        int h = secDescs[s]->height;
-        for(int i = 0; i < h; i++) {
-            for(int j = 0; j < w; j++) {
-                printf("%c ", (char)data[i * w + j]);
+    SendCommand(0x4E); // set RAM x address count to 0;
+    SendData(0x00);
+    SendCommand(0x4F); // set RAM y address count to the window start;
+    SendData(0xF9 - first);
+    SendData(0x00);
+}
+
+/* stream panel rows [first, last] to the RAM selected by the last command */
+void Screen::SendRows(int first, int last)
+{
+    if (rotation == ROTATE_90 || rotation == ROTATE_270)
+    {
+        unsigned char band[8][LINEBYTES], out[LINEBYTES];
+        for (int line = first; line <= last; line++)
+        {
+            if (line == first || line % 8 == 0)
+                ComposeBand(line - line % 8, band);
+            for (int h = 0; h < LINEBYTES; h++)
+            {
+                out[h] = pgm_read_byte(&panel_byte[band[line % 8][LINEBYTES - 1 - h]]);
             }
-            printf("\n");
+            SendDataBlock(out, LINEBYTES);
+        }
+        return;
+    }
+    unsigned char l[LINEBYTES], out[LINEBYTES];
+    RowCursor at;
+    SeekRow(first, &at);
+    for (int line = first; line <= last; line++)
+    {
+        if (rotation == ROTATE_180)
+            ComposeLine(line, l);
+        else
+            ComposeNext(&at, l, sizeof(l));
+        for (int h = 0; h < LINEBYTES; h++)
+        {
+            out[h] = pgm_read_byte(&panel_byte[l[LINEBYTES - 1 - h]]);
         }
+        SendDataBlock(out, LINEBYTES);
     }
 }
 
-void printarray_test(Screen *s)
+/* convert the image row held in the stream to panel bytes and write it at the RAM address counter */
+void Screen::SendImageRow()
 {
-    s->Print();
-}
+    unsigned char out[LINEBYTES];
+    const uint8_t *in = stream.line;
+    if (stream.row < secDescs[stream.section]->height)
+    {
+        // image rows start at the left edge, composed lines LINEPAD bits in
+        for (int h = 0; h < LINEBYTES; h++)
+        {
+            int i = LINEBYTES - 1 - h;
+            uint8_t ink = (in[i] >> LINEPAD) | (i > 0 ? in[i - 1] << (8 - LINEPAD) : 0);
+            out[h] = pgm_read_byte(&panel_byte[ink]);
+        }
+        SendDataBlock(out, LINEBYTES);
+    }
+    stream.row++;
+    stream.at = 0;
+}
+
+/*
+Write panel rows [first, last] to the RAM selected by command (0x24 or 0x26), one window per run
+of rows between the image sections that hold a streamed picture
+*/
+void Screen::SendSpan(int first, int last, unsigned char command)
+{
+    int top = first;
+    for (int s = 0; s < sects && rotation == ROTATE_0 && top <= last; s++)
+    {
+        if (secDescs[s]->font != &imageRows || secDescs[s]->dirtyFirst >= 0)
+            continue;
+        int base = s == 0 ? 0 : secDescs[s - 1]->cap;
+        int bottom = secDescs[s]->cap - 1;
+        if (bottom < top || base > last)
+            continue;
+        if (base > top)
+        {
+            SetWindow(top, base - 1);
+            SendCommand(command);
+            SendRows(top, base - 1);
+        }
+        top = bottom + 1;
+    }
+    if (top <= last)
+    {
+        SetWindow(top, last);
+        SendCommand(command);
+        SendRows(top, last);
+    }
+}
+
+void Screen::Clear()
+{
+    WaitUntilIdle();
+    if (lut != REFRESH_FULL)
+        SetLut(REFRESH_FULL);
+    SetWindow(0, EPD_HEIGHT - 1);
+
+    unsigned char white[LINEBYTES];
+    memset(white, 0xFF, LINEBYTES);
+    SendCommand(0x24);
+    for (int j = 0; j < EPD_HEIGHT; j++)
+    {
+        SendDataBlock(white, LINEBYTES);
+    }
+
+    //DISPLAY REFRESH, mode 2 so ping-pong clears 0x26 as well
+    Activate(0xCF);
+    Refreshed(REFRESH_FULL, 0, EPD_HEIGHT - 1);
+    WaitUntilIdle();
+    fullPending = true;
+    stream.section = -1;
+}
+
+/**
+ *  @brief: Send the screen to the panel and wait for the refresh, see DrawAsync.
+ *          Does nothing while an image is being streamed.
+ */
+void Screen::Draw()
+{
+    if (stream.section >= 0)
+        return;
+    WaitUntilIdle();
+    StartDraw();
+    WaitUntilIdle();
+}
+
+/**
+ *  @brief: Send the screen to the panel and start the refresh without waiting
+ *          for it. Text added while the panel refreshes goes on the next draw.
+ *          Returns 1 without sending anything if the panel is still busy,
+ *          check Poll() first, or an image is being streamed.
+ */
+int Screen::DrawAsync()
+{
+    if (stream.section >= 0 || !Poll())
+        return 1;
+    StartDraw();
+    return 0;
+}
+
+/**
+ *  @brief: The first draw after init, Clear or a wake writes the base image
+ *          with a full refresh; later calls only send the rows changed since the
+ *          previous draw, refreshed the way the RefreshPolicy chooses. A fast or
+ *          full refresh drives the whole panel. Each refresh leaves 0x26 holding
+ *          what it showed (see SetLut). Does nothing if nothing changed. Rows of streamed images are
+ *          never rewritten. The panel must be idle.
+ */
+void Screen::StartDraw()
+{
+    int first, last;
+    if (fullPending)
+    {
+        if (lut != REFRESH_FULL)
+            SetLut(REFRESH_FULL);
+        SendSpan(0, EPD_HEIGHT - 1, 0x24);
+
+        //DISPLAY REFRESH, ping-pong then copies the base image into 0x26
+        Activate(0xCF);
+        Refreshed(REFRESH_FULL, 0, EPD_HEIGHT - 1);
+        lutPending = true;
+        fullPending = false;
+    }
+    else
+    {
+        bool dirty = GetDirtyRows(&first, &last);
+        if (!dirty)
+        {
+            first = imageFirst;
+            last = imageLast;
+        }
+        else if (imageLast >= 0)
+        {
+            first = imageFirst < first ? imageFirst : first;
+            last = imageLast > last ? imageLast : last;
+        }
+        if (last >= first)
+        {
+            uint8_t kind = ChooseRefresh(first, last);
+            if (kind == REFRESH_PARTIAL)
+            {
+                if (dirty)
+                    SendSpan(first, last, 0x24);
+
+                //PARTIAL REFRESH
+                Activate(0x0C);
+            }
+            else
+            {
+                // drives every pixel; ping-pong then copies 0x24 into 0x26, image rows included
+                SetLut(kind);
+                if (dirty)
+                    SendSpan(first, last, 0x24);
+                Activate(0xCF);
+                lutPending = true;
+            }
+            Refreshed(kind, first, last);
+        }
+    }
+    ClearDirty();
+    imageFirst = EPD_HEIGHT;
+    imageLast = -1;
+}
+
+/*
+Choose how the next refreshes are done: policy gets the counters and the draw at hand (see
+RefreshState) and returns a REFRESH_ kind, arg is passed along. The default is refresh_limits
+with refresh_defaults; refresh_partial_only never clears ghosting.
+*/
+void Screen::SetRefreshPolicy(RefreshPolicy p, const void *arg)
+{
+    policy = p != nullptr ? p : refresh_limits;
+    policyArg = arg;
+}
+
+const RefreshState *Screen::GetRefreshState()
+{
+    return &refresh;
+}
+
+/* ask the policy about a draw of panel rows [first, last] */
+uint8_t Screen::ChooseRefresh(int first, int last)
+{
+    refresh.first = first;
+    refresh.last = last;
+    refresh.area = (uint16_t)((long)(last - first + 1) * 1000 / EPD_HEIGHT);
+    refresh.worst = 0;
+    for (int r = first / REFRESH_BAND; r <= last / REFRESH_BAND; r++)
+    {
+        if (refresh.regions[r] > refresh.worst)
+            refresh.worst = refresh.regions[r];
+    }
+    refresh.now = epd->Millis();
+    uint8_t kind = policy(&refresh, policyArg);
+    return kind > REFRESH_FULL ? REFRESH_PARTIAL : kind;
+}
+
+/* count a refresh of panel rows [first, last]; fast and full ones drive every row */
+void Screen::Refreshed(uint8_t kind, int first, int last)
+{
+    if (kind == REFRESH_PARTIAL)
+    {
+        refresh.partial++;
+        for (int r = first / REFRESH_BAND; r <= last / REFRESH_BAND; r++)
+        {
+            if (refresh.regions[r] < 255)
+                refresh.regions[r]++;
+        }
+        return;
+    }
+    if (kind == REFRESH_FAST)
+    {
+        refresh.fast++;
+        refresh.fastsSinceFull++;
+    }
+    else
+    {
+        refresh.full++;
+        refresh.fastsSinceFull = 0;
+    }
+    memset(refresh.regions, 0, sizeof(refresh.regions));
+    refresh.lastClear = epd->Millis();
+}
+
+/* a region has had 40 partial refreshes, or an hour has passed since ghosting was last cleared; every fifth clear is full */
+const RefreshLimits refresh_defaults = { 40, 0, 3600000UL, 4 };
+
+/*
+RefreshPolicy applying the thresholds of a RefreshLimits (arg, nullptr for refresh_defaults):
+partial refreshes until one is reached, then a fast refresh, or a full one once there were
+limits->fasts fast ones in a row
+*/
+uint8_t refresh_limits(const RefreshState *state, const void *arg)
+{
+    const RefreshLimits *limits = arg != nullptr ? (const RefreshLimits *)arg : &refresh_defaults;
+    bool clear = (limits->partials > 0 && state->worst >= limits->partials)
+        || (limits->area > 0 && state->area >= limits->area)
+        || (limits->clearMs > 0 && state->now - state->lastClear >= limits->clearMs);
+    if (!clear)
+        return REFRESH_PARTIAL;
+    return state->fastsSinceFull >= limits->fasts ? REFRESH_FULL : REFRESH_FAST;
+}
+
+/* RefreshPolicy that never clears ghosting; full refreshes only happen after init, Clear or a wake */
+uint8_t refresh_partial_only(const RefreshState *, const void *)
+{
+    return REFRESH_PARTIAL;
+}
+
+#pragma endregion
+
+#pragma region UnitTesting
+
+#ifdef UNIT
+#include <time.h>
+#include "layout.h"
+#include "screen_link.h"
+
+void Screen::Print() {
+    const cell_t *data;
+    for(int s = 0; s < sects; s++) {
+        printf("W %d H %d C %d\n", secDescs[s]->width, secDescs[s]->height, secDescs[s]->cap);
+        data = secCells[s];
+        int w = secDescs[s]->width;
+        int h = secDescs[s]->height;
+        for(int i = 0; i < h; i++) {
+            for(int j = 0; j < w; j++) {
+                cell_t cell = data[((i + secDescs[s]->head) % h) * w + j];
+                printf("%c ", cell == CELL_EMPTY ? ' ' : (char)(' ' + cell - 1));
+            }
+            printf("\n");
+        }
+    }
+}
+
+/* reference byte-at-a-time blit, as GetLine used before the Blitter (input is aligned left) */
+inline void writebuf(unsigned char *input, unsigned char *dst, uint8_t startBit, uint8_t lengthBits) {
+    unsigned char byte = input[0];
+    // write non-aligned
+    uint8_t mask, rem, oft, index = startBit / 8;
+    oft = startBit % 8;
+    rem = 8-oft;
+    mask = ((1 << rem) - 1); // 0^oft||1^(rem)
+    // if whole thing fits in first byte
+    if(lengthBits+oft < 8) { 
+        rem = lengthBits;
+        mask = mask << (8-lengthBits-oft);
+    }
+    byte = (byte >> oft) & mask;
+    dst[index] |= byte;
+    index++;
+    // write aligned
+    uint8_t alignedBytes = (lengthBits - rem)/8;
+    int i;
+    for(i = 0; i < alignedBytes; i++) {
+        // mask in case of arithmetic shift
+        byte = (input[i] << rem) | ((input[i+1] >> oft) & mask);
+        dst[index + i] = byte;
+    }
+    // write non-aligned
+    uint8_t lastSize = lengthBits - (8 * alignedBytes) - rem;
+    mask = ~((1 << (8 - lastSize)) - 1);
+    if(lastSize != 0) {
+        byte = ((input[i] << rem) | (input[i+1] >> oft)) & mask;
+        dst[index + alignedBytes] |= byte;
+    }
+}
+
+void printarray_test(Screen *s)
+{
+    s->Print();
+}
 
 void getline_test(Screen *s)
 {
@@ -493,17 +2205,2355 @@ void betterbitmap_test() {
     free(in);
 }
 
-sFONT Font8 = {
-    nullptr,
-    5, /* Width */
-    8, /* Height */
-};
-sFONT Font12 = {
-    nullptr,
-    7, /* Width */
-    12, /* Height */
+/* Blitter against writebuf for every start bit and length in a line, then the width fast paths */
+void blit_test() {
+    const uint8_t chunks[] = { 5, 7, 11, 14, 17, 24, 1, 8 };
+    unsigned char in[LINEBYTES + 1], ref[LINEBYTES + 1], out[LINEBYTES + 1];
+    int cases = 0, failures = 0;
+    srand(1);
+    for(int start = 0; start < LINEBITS; start++) {
+        for(int len = 1; start + len <= LINEBITS; len++) {
+            for(int i = 0; i <= LINEBYTES; i++)
+                in[i] = rand();
+            memset(ref, 0, sizeof(ref));
+            if(start % 8) // bits ahead of the start must survive
+                ref[start / 8] = (rand() & 0xFF) & ~(0xFF >> (start % 8));
+            memcpy(out, ref, sizeof(ref));
+            writebuf(in, ref, start, len);
+
+            Blitter b;
+            blit_begin(&b, out, start);
+            for(int pos = 0, c = 0; pos < len; c++) {
+                uint8_t n = chunks[c % sizeof(chunks)];
+                if(n > len - pos)
+                    n = len - pos;
+                uint32_t row = 0;
+                for(int k = 0; k < n; k++)
+                    row = (row << 1) | ((in[(pos + k) / 8] >> (7 - (pos + k) % 8)) & 1);
+                blit_push(&b, row, n);
+                pos += n;
+            }
+            blit_end(&b);
+            cases++;
+            failures += memcmp(ref, out, LINEBYTES) != 0;
+        }
+    }
+    // width fast paths: byte and packed tables against writebuf over the byte table
+    sFONT *fonts[] = { &Font8, &Font12, &Font16, &Font20, &Font24 };
+    sFONT *packed[] = { &Font8P, &Font12P, &Font16P, &Font20P, &Font24P };
+    for(int f = 0; f < 5; f++) {
+        cell_t cells[LINEBITS];
+        const uint8_t *table = fonts[f]->table, *ptable = packed[f]->table;
+        unsigned int gb = font_glyph_bytes(fonts[f]), pgb = font_glyph_bytes(packed[f]);
+        uint8_t w = fonts[f]->Width, bytes = (w + 7) / 8;
+        uint8_t count = (LINEBITS - LINEPAD) / w;
+        for(uint8_t i = 0; i < count; i++)
+            cells[i] = rand() % 8 == 0 ? CELL_EMPTY : (cell_t)(rand() % 95 + 1);
+        for(uint8_t subln = 0; subln < fonts[f]->Height; subln++) {
+            unsigned char pout[LINEBYTES + 1];
+            unsigned char cbyte[GLYPHBYTES + 1] = { 0 };
+            memset(ref, 0, sizeof(ref));
+            memset(out, 0, sizeof(out));
+            memset(pout, 0, sizeof(pout));
+            for(uint8_t i = 0; i < count; i++) {
+                if(cells[i] == CELL_EMPTY)
+                    continue;
+                memcpy(cbyte, cell_glyph(table, cells[i], gb) + subln * bytes, bytes);
+                writebuf(cbyte, ref, LINEPAD + i * w, w);
+            }
+            Blitter b, pb;
+            blit_begin(&b, out, LINEPAD);
+            blit_begin(&pb, pout, LINEPAD);
+            switch(w) {
+                case 5: blit_glyphs_w<5, false>(&b, cells, count, table, gb, subln); blit_glyphs_w<5, true>(&pb, cells, count, ptable, pgb, subln); break;
+                case 7: blit_glyphs_w<7, false>(&b, cells, count, table, gb, subln); blit_glyphs_w<7, true>(&pb, cells, count, ptable, pgb, subln); break;
+                case 11: blit_glyphs_w<11, false>(&b, cells, count, table, gb, subln); blit_glyphs_w<11, true>(&pb, cells, count, ptable, pgb, subln); break;
+                case 14: blit_glyphs_w<14, false>(&b, cells, count, table, gb, subln); blit_glyphs_w<14, true>(&pb, cells, count, ptable, pgb, subln); break;
+                default: blit_glyphs_w<17, false>(&b, cells, count, table, gb, subln); blit_glyphs_w<17, true>(&pb, cells, count, ptable, pgb, subln); break;
+            }
+            blit_end(&b);
+            blit_end(&pb);
+            cases++;
+            failures += memcmp(ref, out, LINEBYTES) != 0 || memcmp(ref, pout, LINEBYTES) != 0;
+        }
+    }
+    printf("blit: %d cases, %d failures\n", cases, failures);
+}
+
+void partial_test() {
+    EpdSim sim;
+    Screen s(&sim);
+    char top[] = "status";
+    char body[] = "line one  line two";
+    s.ScreenInit(2);
+    s.DefineSection(0, 1, &Font8);
+    s.DefineSection(1, 2, &Font12);
+    s.AddText(0, top);
+    s.AddText(1, body);
+    sim.ResetStats();
+    s.Draw();
+    printf("full: %ld rows to 0x24, %ld rows to 0x26, %d full refresh\n",
+        sim.stats.perCommand[0x24] / LINEBYTES, sim.stats.perCommand[0x26] / LINEBYTES, sim.stats.fullRefreshes);
+
+    body[6] = 'l'; // line one -> line ole, section 1 glyph line 0
+    sim.ResetStats();
+    s.Draw(); // nothing to do
+    printf("idle draw: %ld commands\n", sim.stats.commands);
+    s.AddText(1, body);
+    sim.ResetStats();
+    s.Draw();
+    printf("partial: rows %d..%d (%ld rows sent), section 1 spans %d..%d, %d partial refresh\n",
+        sim.stats.rowFirst, sim.stats.rowLast, sim.stats.ramBytes / LINEBYTES,
+        Font8.Height, Font8.Height + 2 * Font12.Height - 1, sim.stats.partialRefreshes);
+}
+
+/* pixels the simulated panel shows differently from what ComposeLine gives for each panel row of s */
+int sim_mismatches(EpdSim *sim, Screen *s) {
+    unsigned char line[LINEBYTES];
+    int mismatches = 0;
+    for(int y = 0; y < EPD_HEIGHT; y++) {
+        s->ComposeLine(y, line);
+        for(int x = 0; x < EPD_WIDTH; x++) {
+            int bit = x + LINEPAD;
+            mismatches += sim->Pixel(x, y) != (bool)((line[bit / 8] >> (7 - bit % 8)) & 1);
+        }
+    }
+    return mismatches;
+}
+
+/* the simulated panel shows exactly what RenderLine produced; writes sim.pbm */
+void sim_test() {
+    EpdSim sim;
+    Screen s(&sim);
+    char txt[] = "Simulated\npanel\n0123456789";
+    s.ScreenInit(3);
+    s.DefineSection(0, 2, &Font12);
+    s.DefineSection(1, 3, &Font16P);
+    s.DefineSection(2, 2, &Font24);
+    for(int i = 0; i < 3; i++)
+        s.Print(i, txt, ALIGN_CENTER);
+    sim.ResetStats();
+    s.Draw();
+
+    int mismatches = sim_mismatches(&sim, &s);
+    sim.WritePBM("sim.pbm");
+    printf("sim: %ld commands, %ld data bytes, %d+%d refreshes taking %lu ms, %d mismatched pixels\n",
+        sim.stats.commands, sim.stats.dataBytes, sim.stats.fullRefreshes, sim.stats.partialRefreshes,
+        sim.stats.refreshMs, mismatches);
+}
+
+/* input keeps arriving every 50 ms of simulated time while refreshes run in the background */
+void async_test() {
+    EpdSim sim;
+    Screen s(&sim);
+    char txt[16];
+    s.ScreenInit(1);
+    s.DefineSection(0, 1, &Font24);
+    unsigned long start = sim.Millis();
+    int accepted = 0, whileBusy = 0, draws = 0;
+    for(int i = 0; i < 100; i++) {
+        snprintf(txt, sizeof(txt), "%d", i);
+        s.Print(0, txt);
+        accepted++;
+        if(s.Poll())
+            draws += s.DrawAsync() == 0;
+        else
+            whileBusy++;
+        sim.Delay(50);
+    }
+    s.Draw(); // commit the last update and wait
+    unsigned long elapsed = sim.Millis() - start;
+
+    int mismatches = sim_mismatches(&sim, &s);
+    printf("async: %d updates in %lu ms, %d arrived during a refresh, %d+%d refreshes (%d DrawAsync), %d mismatched pixels\n",
+        accepted, elapsed, whileBusy, sim.stats.fullRefreshes, sim.stats.partialRefreshes, draws, mismatches);
+}
+
+/* a wake from deep sleep sets the controller up again, so the draws after it show the screen exactly */
+void wake_test() {
+    EpdSim sim;
+    Screen s(&sim);
+    char txt[16];
+    s.ScreenInit(2);
+    s.DefineSection(0, 2, &Font12);
+    s.DefineSection(1, 3, &Font16);
+    snprintf(txt, sizeof(txt), "before");
+    s.Print(0, txt);
+    s.Draw();
+    snprintf(txt, sizeof(txt), "asleep");
+    s.Print(1, txt);
+    s.Draw(); // partial LUT loaded
+    s.Sleep();
+    snprintf(txt, sizeof(txt), "awake");
+    s.Print(0, txt);
+    s.Reset();
+    sim.ResetStats();
+    s.Draw();
+    int full = sim_mismatches(&sim, &s), fullFrames = sim.stats.lastFrames;
+    snprintf(txt, sizeof(txt), "12:00");
+    s.Print(1, txt);
+    s.Draw();
+    printf("wake: %d+%d refreshes of %d and %d frames, %d mismatched pixels after the wake, %d after the next partial refresh\n",
+        sim.stats.fullRefreshes, sim.stats.partialRefreshes, fullFrames, sim.stats.lastFrames, full, sim_mismatches(&sim, &s));
+}
+
+/* one decoded glyph row in cache_bench's direct-mapped cache */
+struct CacheSlot {
+    const uint8_t *glyph; // font table address, so font and character together
+    uint8_t subrow;
+    uint32_t row;
 };
 
+/*
+Would a cache of decoded glyph rows pay off? The glyph rows a three font dashboard decodes per
+frame, in the order the panel rows need them, go through a direct-mapped cache keyed by glyph and
+sub-row at several RAM budgets, against calling glyph_row for every one. Byte and packed fonts.
+*/
+void cache_bench() {
+    const int frames = 3000;
+    const size_t budgets[] = { 0, 256, 1024, 4096, 16384 };
+    static CacheSlot slots[16384 / sizeof(CacheSlot)];
+    static const uint8_t *glyphs[4096];
+    static uint8_t widths[4096], sublns[4096];
+    const char *text[] = { "Greenhouse 3", "Temp   21.5C", "Humid  40.2%", "Soil   33.0%", "Light  1200lx",
+        "CO2    410ppm", "updated 12:45:10 OK" };
+    const int style[] = { 0, 1, 1, 1, 1, 1, 2 };
+    sFONT *fonts[2][3] = { { &Font24, &Font16, &Font12 }, { &Font24P, &Font16P, &Font12P } };
+    int failures = 0;
+    for(int packed = 0; packed < 2; packed++) {
+        int n = 0;
+        for(int t = 0; t < 7; t++) {
+            sFONT *font = fonts[packed][style[t]];
+            int chars = (int)strlen(text[t]) < EPD_WIDTH / font->Width ? (int)strlen(text[t]) : EPD_WIDTH / font->Width;
+            for(int subln = 0; subln < font->Height; subln++)
+                for(int i = 0; i < chars; i++, n++) {
+                    glyphs[n] = font->table + (text[t][i] - ' ') * font_glyph_bytes(font);
+                    widths[n] = font->Width;
+                    sublns[n] = subln;
+                }
+        }
+        double base = 0;
+        uint32_t expect = 0;
+        for(size_t budget : budgets) {
+            unsigned int mask = 0; // slots, rounded down to a power of two, less one
+            while((mask + 1) * 2 * sizeof(CacheSlot) <= budget)
+                mask = mask * 2 + 1;
+            memset(slots, 0, sizeof(slots));
+            unsigned long hits = 0;
+            uint32_t sum = 0;
+            clock_t c = clock();
+            for(int f = 0; f < frames; f++) {
+                for(int i = 0; i < n; i++) {
+                    if(budget == 0) {
+                        sum += glyph_row(glyphs[i], widths[i], sublns[i], packed);
+                        continue;
+                    }
+                    unsigned int h = (unsigned int)(uintptr_t)glyphs[i] * 31u + sublns[i];
+                    CacheSlot *slot = &slots[(h ^ (h >> 7)) & mask];
+                    if(slot->glyph == glyphs[i] && slot->subrow == sublns[i]) {
+                        hits++;
+                    } else {
+                        slot->glyph = glyphs[i];
+                        slot->subrow = sublns[i];
+                        slot->row = glyph_row(glyphs[i], widths[i], sublns[i], packed);
+                    }
+                    sum += slot->row;
+                }
+            }
+            double secs = (double)(clock() - c) / CLOCKS_PER_SEC;
+            if(budget == 0) {
+                base = secs;
+                expect = sum;
+            }
+            failures += sum != expect;
+            printf("cache: %s %5d bytes: %5.1f%% hits, %.2fx\n", packed ? "packed" : "bytes ", (int)budget,
+                100.0 * hits / ((double)frames * n), base / secs);
+        }
+    }
+    printf("cache: %d failures\n", failures);
+}
+
+/* modelled bus throughput of a frame sent a byte at a time against one block per scanline */
+void transfer_bench() {
+    EpdSim sim;
+    Screen s(&sim);
+    char txt[] = "Batched transfers keep chip select low for a whole scanline";
+    unsigned char line[LINEBYTES], out[LINEBYTES];
+    s.ScreenInit(1);
+    s.DefineSection(0, EPD_HEIGHT / Font12.Height, &Font12);
+    s.AddText(0, txt);
+    for(int blocks = 0; blocks < 2; blocks++) {
+        sim.ResetStats();
+        for(int row = 0; row < EPD_HEIGHT; row++) {
+            s.ComposeLine(row, line);
+            for(int h = 0; h < LINEBYTES; h++)
+                out[h] = pgm_read_byte(&panel_byte[line[LINEBYTES - 1 - h]]);
+            if(blocks) {
+                sim.DataBlock(out, LINEBYTES);
+            } else {
+                for(int h = 0; h < LINEBYTES; h++)
+                    sim.Data(out[h]);
+            }
+        }
+        const EpdTransferStats *t = &sim.transfer;
+        printf("%s %lu bytes in %lu transfers, %lu us, %.0f bytes/s\n", blocks ? "SendDataBlock:" : "SendData:     ",
+            t->bytes, t->transfers, t->micros, t->bytes * 1e6 / t->micros);
+    }
+}
+
+/* heap calls and rows/second of the allocating GetLine against RenderLine */
+void render_bench(Screen *s) {
+    const int frames = 400;
+    unsigned char line[LINEBYTES];
+    long allocs = unit_allocs;
+    clock_t t = clock();
+    for(int f = 0; f < frames; f++)
+        for(int row = 0; row < EPD_HEIGHT; row++)
+            free(s->GetLine(row));
+    double secs = (double)(clock() - t) / CLOCKS_PER_SEC;
+    printf("GetLine:    %ld allocs/frame, %.0f rows/s\n",
+        (unit_allocs - allocs) / frames, frames * EPD_HEIGHT / secs);
+
+    allocs = unit_allocs;
+    t = clock();
+    for(int f = 0; f < frames; f++)
+        for(int row = 0; row < EPD_HEIGHT; row++)
+            s->RenderLine(row, line);
+    secs = (double)(clock() - t) / CLOCKS_PER_SEC;
+    printf("RenderLine: %ld allocs/frame, %.0f rows/s\n",
+        (unit_allocs - allocs) / frames, frames * EPD_HEIGHT / secs);
+}
+
+/* reference bit reversal, as Draw used before panel_byte */
+unsigned char rev_byte(unsigned char c) {
+    unsigned char b = 0;
+    for (int i = 0; i < 8; i++)
+    {
+        b = b << 1;
+        b |= (c >> i) & 0x1;
+    }
+    return b;
+}
+
+/* panel bytes/second of RenderLine + rev_byte against ComposeLine + panel_byte */
+void panel_byte_bench(Screen *s) {
+    const int frames = 400;
+    unsigned char line[LINEBYTES], ref[LINEBYTES];
+    volatile unsigned char sink;
+    int mismatches = 0;
+    for(int row = 0; row < EPD_HEIGHT; row++) {
+        s->RenderLine(row, ref);
+        s->ComposeLine(row, line);
+        for(int h = 0; h < LINEBYTES; h++)
+            mismatches += rev_byte(ref[h]) != pgm_read_byte(&panel_byte[line[h]]);
+    }
+
+    clock_t t = clock();
+    for(int f = 0; f < frames; f++)
+        for(int row = 0; row < EPD_HEIGHT; row++) {
+            s->RenderLine(row, line);
+            for(int h = LINEBYTES - 1; h >= 0; h--)
+                sink = rev_byte(line[h]);
+        }
+    double secs = (double)(clock() - t) / CLOCKS_PER_SEC;
+    printf("rev_byte:   %.0f bytes/s\n", frames * EPD_HEIGHT * LINEBYTES / secs);
+
+    t = clock();
+    for(int f = 0; f < frames; f++)
+        for(int row = 0; row < EPD_HEIGHT; row++) {
+            s->ComposeLine(row, line);
+            for(int h = LINEBYTES - 1; h >= 0; h--)
+                sink = pgm_read_byte(&panel_byte[line[h]]);
+        }
+    secs = (double)(clock() - t) / CLOCKS_PER_SEC;
+    printf("panel_byte: %.0f bytes/s, %d mismatches\n", frames * EPD_HEIGHT * LINEBYTES / secs, mismatches);
+    (void)sink;
+}
+
+/* rows/second composing full screens of each font from the byte and the packed tables */
+void packed_bench() {
+    const int frames = 200;
+    char txt[] = "Temperature 21.5C Humidity 40% Pressure 1013hPa Wind 12km/h NNE";
+    unsigned char line[LINEBYTES];
+    sFONT *fonts[] = { &Font8, &Font8P, &Font12, &Font12P, &Font16, &Font16P, &Font20, &Font20P, &Font24, &Font24P };
+    for(sFONT *font : fonts) {
+        Screen s;
+        s.ScreenInit(1);
+        s.DefineSection(0, EPD_HEIGHT / font->Height, font);
+        s.AddText(0, txt);
+        clock_t t = clock();
+        for(int f = 0; f < frames; f++)
+            for(int row = 0; row < EPD_HEIGHT; row++)
+                s.ComposeLine(row, line);
+        double secs = (double)(clock() - t) / CLOCKS_PER_SEC;
+        printf("%2dx%-2d %s %5d table bytes, %.0f rows/s\n", font->Width, font->Height,
+            font->Format == FONT_FORMAT_PACKED ? "packed" : "bytes ", 95 * font_glyph_bytes(font), frames * EPD_HEIGHT / secs);
+    }
+}
+
+/* RAM and compose rate of DefineSection sections against the same compile-time Layout */
+void layout_bench() {
+    typedef Layout<LayoutSection<Font8Spec, 3>, LayoutSection<Font12Spec, 4>, LayoutSection<Font8Spec, 8> > Dash;
+    typedef Dash::Storage DashStorage;
+    const int frames = 400;
+    char txt[] = "The quick brown fox jumps over the lazy dog 0123456789 and then some more text to fill it";
+    unsigned char line[LINEBYTES], ref[LINEBYTES];
+    Screen dyn, fixed;
+
+    long allocs = unit_allocs, heap = unit_heap;
+    dyn.ScreenInit(3);
+    dyn.DefineSection(0, 3, &Font8);
+    dyn.DefineSection(1, 4, &Font12);
+    dyn.DefineSection(2, 8, &Font8);
+    printf("DefineSection: %ld heap blocks, %ld bytes\n", unit_allocs - allocs, unit_heap - heap);
+    size_t bytes = dyn.SectionBytes(-1);
+    size_t chars = (bytes - 3 * (sizeof(Section) + 2 * sizeof(void *))) / sizeof(cell_t);
+    printf("SectionBytes:  %d (%s heap), %d with glyph pointer cells\n", (int)bytes,
+        (long)bytes == unit_heap - heap ? "matches" : "DIFFERS FROM", (int)(bytes + chars * (sizeof(const uint8_t *) - sizeof(cell_t))));
+    allocs = unit_allocs;
+    fixed.ScreenInit(Dash::Get());
+    printf("Layout:        %ld heap blocks, %d static bytes, %d flash bytes of row map\n", unit_allocs - allocs,
+        (int)(sizeof(DashStorage::descs) + sizeof(DashStorage::descPtrs) + sizeof(DashStorage::cells) + sizeof(DashStorage::cellPtrs)),
+        (int)sizeof(DashStorage::rows));
+
+    int mismatches = 0;
+    for(int sec = 0; sec < 3; sec++) {
+        dyn.AddText(sec, txt);
+        fixed.AddText(sec, txt);
+    }
+    for(int row = 0; row < EPD_HEIGHT; row++) {
+        dyn.ComposeLine(row, ref);
+        fixed.ComposeLine(row, line);
+        mismatches += memcmp(ref, line, LINEBYTES) != 0;
+    }
+
+    Screen *screens[] = { &dyn, &fixed };
+    for(Screen *s : screens) {
+        clock_t t = clock();
+        for(int f = 0; f < frames; f++)
+            for(int row = 0; row < EPD_HEIGHT; row++)
+                s->ComposeLine(row, line);
+        double secs = (double)(clock() - t) / CLOCKS_PER_SEC;
+        printf("%s %.0f rows/s\n", s == &dyn ? "DefineSection:" : "Layout:       ", frames * EPD_HEIGHT / secs);
+    }
+    printf("layout: %d mismatched rows\n", mismatches);
+}
+
+void arena_test() {
+    const int rounds = 5000;
+    int lines[][3] = { { 3, 4, 8 }, { 1, 10, 2 }, { 6, 2, 1 } };
+    sFONT *fonts[][3] = { { &Font8, &Font12, &Font8 }, { &Font20, &Font12, &Font16 }, { &Font8, &Font24, &Font12 } };
+    char txt[] = "The quick brown fox jumps over the lazy dog 0123456789";
+    static uint8_t buffer[1024];
+    unsigned char line[LINEBYTES], ref[LINEBYTES];
+    Screen s, heap;
+
+    int mismatches = 0, failures = 0;
+    for(int k = 0; k < 3; k++) {
+        size_t need = Screen::ArenaBytes(3, lines[k], fonts[k]);
+        // one byte short must be refused by ScreenInit or the last DefineSection
+        int shortFail = s.ScreenInit(3, buffer + 1, need - 1);
+        for(int sec = 0; sec < 3 && !shortFail; sec++)
+            shortFail = s.DefineSection(sec, lines[k][sec], fonts[k][sec]);
+        failures += !shortFail;
+        failures += s.ScreenInit(3, buffer + 1, need) != 0;
+        heap.ScreenInit(3);
+        for(int sec = 0; sec < 3; sec++) {
+            failures += s.DefineSection(sec, lines[k][sec], fonts[k][sec]) != 0;
+            heap.DefineSection(sec, lines[k][sec], fonts[k][sec]);
+            s.AddText(sec, txt);
+            heap.AddText(sec, txt);
+        }
+        for(int row = 0; row < EPD_HEIGHT; row++) {
+            heap.ComposeLine(row, ref);
+            s.ComposeLine(row, line);
+            mismatches += memcmp(ref, line, LINEBYTES) != 0;
+        }
+    }
+
+    // a chart ahead of a text section, sized from its samples and clamped to the canvas like DefineChart
+    int mixedLines[] = { 40, 2, 8 }, samples[][3] = { { 101, 0, 0 }, { 500, 0, 0 } };
+    sFONT *mixedFonts[] = { nullptr, &Font12, nullptr };
+    for(int k = 0; k < 2; k++) {
+        size_t need = Screen::ArenaBytes(3, mixedLines, mixedFonts, nullptr, ROTATE_0, samples[k]);
+        for(size_t size = need - 1; size <= need; size++) {
+            int fail = s.ScreenInit(3, buffer + 1, size);
+            fail = fail || s.DefineChart(0, mixedLines[0], samples[k][0]);
+            fail = fail || s.DefineSection(1, mixedLines[1], mixedFonts[1]);
+            fail = fail || s.DefineGraphics(2, 20, mixedLines[2]);
+            failures += size == need ? fail : !fail;
+        }
+    }
+
+    Screen *screens[] = { &heap, &s };
+    for(Screen *scr : screens) {
+        long allocs = unit_allocs, bytes = unit_heap;
+        struct mallinfo2 before = mallinfo2();
+        for(int r = 0; r < rounds; r++) {
+            int k = r % 3;
+            if(scr == &s)
+                scr->ScreenInit(3, buffer, sizeof(buffer));
+            else
+                scr->ScreenInit(3);
+            for(int sec = 0; sec < 3; sec++)
+                scr->DefineSection(sec, lines[k][sec], fonts[k][sec]);
+        }
+        struct mallinfo2 after = mallinfo2();
+        printf("%s %d layouts: %ld heap blocks, %ld bytes requested, %ld bytes in use after\n", scr == &s ? "arena:" : "heap: ",
+            rounds, unit_allocs - allocs, unit_heap - bytes, (long)(after.uordblks - before.uordblks));
+    }
+    printf("arena: %d failures, %d mismatched rows\n", failures, mismatches);
+}
+
+/* reference Print, as it was before formatting went straight into the cells: stage in a heap buffer then AddText */
+void print_ref(Screen *s, int section, int w, int h, char *txt, int align) {
+    char *buffer = (char *)malloc((w * h * sizeof(char)) + 1);
+    buffer[w * h] = '\0';
+    int start = 0; int end = 0;
+    for(int line = 0; line < h; line++) {
+        while(txt[end] != '\0' && txt[end] != '\n' && end - start != w)
+            end++;
+        if((end - start) == w || align == ALIGN_LEFT) {
+            for (int i = 0; i < w; i++)
+                buffer[line * w + i] = i < end-start ? txt[start + i] : ' ';
+        } else if(align == ALIGN_RIGHT) {
+            int bc = w - end + start;
+            for(int i = 0; i < w; i++)
+                buffer[line*w + i] = i < bc ? ' ' : txt[start + i - bc];
+        } else {
+            int ws0 = (w - end + start) / 2;
+            int ws1 = ws0 + end - start;
+            for(int i = 0; i < w; i++)
+                buffer[line * w + i] = i < ws0 || i >= ws1 ? ' ' : txt[start + i - ws0];
+        }
+        if(txt[end] == '\n') {
+            start = end+1;
+            end = start;
+        }
+        else if(txt[end] == '\0') {
+            buffer[(line+1) * w] = '\0';
+            break;
+        } else {
+            start = end;
+            end = start;
+        }
+    }
+    s->AddText(section, buffer);
+    free(buffer);
+}
+
+/* Print against the staged reference on random text, then calls/s for each alignment */
+void print_bench() {
+    const int calls = 20000;
+    const int w = EPD_WIDTH / Font8.Width, h = 6;
+    unsigned char line[LINEBYTES], ref[LINEBYTES];
+    char txt[512];
+    Screen s, r;
+    s.ScreenInit(1);
+    r.ScreenInit(1);
+    s.DefineSection(0, h, &Font8);
+    r.DefineSection(0, h, &Font8);
+
+    int mismatches = 0;
+    for(int k = 0; k < 2000; k++) {
+        int len = rand() % (int)sizeof(txt);
+        for(int i = 0; i < len; i++)
+            txt[i] = rand() % 6 == 0 ? '\n' : (char)(' ' + rand() % 95);
+        txt[len] = '\0';
+        int align = rand() % 3;
+        s.Print(0, txt, align);
+        print_ref(&r, 0, w, h, txt, align);
+        for(int row = 0; row < h * Font8.Height; row++) {
+            s.ComposeLine(row, line);
+            r.ComposeLine(row, ref);
+            mismatches += memcmp(ref, line, LINEBYTES) != 0;
+        }
+    }
+
+    char shortTxt[] = "21.5C\nok";
+    memset(txt, 'x', sizeof(txt) - 1);
+    txt[sizeof(txt) - 1] = '\0';
+    char *inputs[] = { shortTxt, txt };
+    const char *names[] = { "left  ", "center", "right " };
+    for(char *in : inputs) {
+        for(int align = 0; align < 3; align++) {
+            long allocs = unit_allocs;
+            clock_t t = clock();
+            for(int c = 0; c < calls; c++)
+                s.Print(0, in, align);
+            double secs = (double)(clock() - t) / CLOCKS_PER_SEC;
+            allocs = unit_allocs - allocs;
+            t = clock();
+            for(int c = 0; c < calls; c++)
+                print_ref(&r, 0, w, h, in, align);
+            double refSecs = (double)(clock() - t) / CLOCKS_PER_SEC;
+            printf("Print %s %s %.0f calls/s (%ld heap blocks), staged %.0f calls/s\n", in == txt ? "long " : "short", names[align],
+                calls / secs, allocs, calls / refSecs);
+        }
+    }
+    printf("print: %d mismatched rows\n", mismatches);
+}
+
+/* whole frames composed row by row with ComposeLine (section scan and a divide per row) against a RowCursor */
+void row_bench() {
+    typedef Layout<LayoutSection<Font8Spec, 2>, LayoutSection<Font16Spec, 3>, LayoutSection<Font12Spec, 4> > Dash;
+    const int frames = 400;
+    char txt[] = "The quick brown fox jumps over the lazy dog 0123456789";
+    unsigned char line[LINEBYTES], ref[LINEBYTES];
+    Screen dyn, fixed;
+    dyn.ScreenInit(4);
+    dyn.DefineSection(0, 2, &Font8);
+    dyn.DefineSection(1, 3, &Font16);
+    dyn.DefineSection(2, 0, &Font20);
+    dyn.DefineSection(3, 4, &Font12);
+    fixed.ScreenInit(Dash::Get());
+    for(int sec = 0; sec < 4; sec++)
+        dyn.AddText(sec, txt);
+    for(int sec = 0; sec < 3; sec++)
+        fixed.AddText(sec, txt);
+
+    int mismatches = 0;
+    Screen *screens[] = { &dyn, &fixed };
+    for(Screen *s : screens) {
+        for(int first = 0; first < EPD_HEIGHT; first += 37) {
+            RowCursor at;
+            s->SeekRow(first, &at);
+            for(int row = first; row < EPD_HEIGHT; row++) {
+                s->ComposeLine(row, ref);
+                s->ComposeNext(&at, line);
+                mismatches += memcmp(ref, line, LINEBYTES) != 0;
+            }
+        }
+        clock_t t = clock();
+        for(int f = 0; f < frames; f++)
+            for(int row = 0; row < EPD_HEIGHT; row++)
+                s->ComposeLine(row, line);
+        double lookup = (double)(clock() - t) / CLOCKS_PER_SEC;
+        t = clock();
+        for(int f = 0; f < frames; f++) {
+            RowCursor at;
+            s->SeekRow(0, &at);
+            for(int row = 0; row < EPD_HEIGHT; row++)
+                s->ComposeNext(&at, line);
+        }
+        double cursor = (double)(clock() - t) / CLOCKS_PER_SEC;
+        // avr-gcc turns each row's / and % into one __divmodhi4 call, roughly 220 cycles without a hardware divider
+        int divmods = s == &dyn ? EPD_HEIGHT : 0;
+        printf("%s ComposeLine %.1f us/frame, RowCursor %.1f us/frame, divmod calls per frame %d -> %d (~%ld AVR cycles saved)\n",
+            s == &dyn ? "DefineSection:" : "Layout:       ", lookup * 1e6 / frames, cursor * 1e6 / frames,
+            divmods, divmods ? 1 : 0, 220L * (divmods ? divmods - 1 : 0));
+    }
+    printf("rows: %d mismatched rows\n", mismatches);
+}
+
+/* the last lines of a log Printed from the top, as a terminal would be redrawn without AppendLine */
+void log_ref(Screen *r, char hist[][EPD_WIDTH / 5 + 1], int kept, int oldest, int lines) {
+    static char text[(EPD_WIDTH / 5 + 1) * (EPD_HEIGHT / 8)];
+    char *p = text;
+    for(int k = 0; k < kept; k++)
+        p += sprintf(p, "%s\n", hist[(oldest + k) % lines]);
+    r->Print(1, text);
+}
+
+/* a status line over a scrolling log: AppendLine against re-Printing the history, then partial refreshes in the sim */
+void log_bench() {
+    const int appends = 200000, lines = (EPD_HEIGHT - Font12.Height) / Font8.Height;
+    const int w = EPD_WIDTH / Font8.Width;
+    static char hist[EPD_HEIGHT / 8][EPD_WIDTH / 5 + 1];
+    char entry[64];
+    EpdSim sim;
+    Screen s(&sim), r;
+    char status[] = "log";
+    s.ScreenInit(2);
+    r.ScreenInit(2);
+    s.DefineSection(0, 1, &Font12);
+    r.DefineSection(0, 1, &Font12);
+    s.DefineSection(1, lines, &Font8);
+    r.DefineSection(1, lines, &Font8);
+    s.AddText(0, status);
+    r.AddText(0, status);
+
+    unsigned char line[LINEBYTES], ref[LINEBYTES];
+    int mismatches = 0, kept = 0, oldest = 0;
+    for(int n = 0; n < 3 * lines; n++) {
+        snprintf(entry, sizeof(entry), "%d t=%d %s", n, rand() % 1000, n % 3 ? "ok" : "retrying connection");
+        s.AppendLine(1, entry);
+        snprintf(hist[(oldest + kept) % lines], w + 1, "%s", entry); // AppendLine drops what does not fit
+        if(kept < lines)
+            kept++;
+        else
+            oldest = (oldest + 1) % lines;
+        log_ref(&r, hist, kept, oldest, lines);
+        for(int row = 0; row < EPD_HEIGHT; row++) {
+            s.ComposeLine(row, line);
+            r.ComposeLine(row, ref);
+            mismatches += memcmp(ref, line, LINEBYTES) != 0;
+        }
+    }
+
+    strcpy(entry, "12:00:01 sensor 3 reading 21.5C");
+    clock_t t = clock();
+    for(int n = 0; n < appends; n++)
+        s.AppendLine(1, entry);
+    double secs = (double)(clock() - t) / CLOCKS_PER_SEC;
+    t = clock();
+    for(int n = 0; n < appends / 100; n++) {
+        snprintf(hist[oldest], w + 1, "%s", entry);
+        oldest = (oldest + 1) % lines;
+        log_ref(&r, hist, kept, oldest, lines);
+    }
+    double refSecs = (double)(clock() - t) / CLOCKS_PER_SEC;
+    printf("log: AppendLine %.0f lines/s, rebuild and Print %.0f lines/s\n", appends / secs, appends / 100 / refSecs);
+
+    s.Draw();
+    sim.ResetStats();
+    const int draws = 20;
+    for(int n = 0; n < draws; n++) {
+        snprintf(entry, sizeof(entry), "event %d", n);
+        s.AppendLine(1, entry);
+        s.Draw();
+    }
+    printf("log: %d appends drawn, %ld rows sent per Draw (status rows untouched: %s), %d partial refreshes, %d mismatched rows, %d mismatched pixels\n",
+        draws, sim.stats.ramBytes / LINEBYTES / draws, sim.stats.rowFirst >= Font12.Height ? "yes" : "no",
+        sim.stats.partialRefreshes, mismatches, sim_mismatches(&sim, &s));
+}
+
+/* reference Print for the fuzz test: split txt into paragraphs at newlines, then cut each
+ paragraph into lines, searching back from the width for a word break when wrapping */
+int wrap_ref(Screen *s, int section, int w, int h, const char *txt, int align) {
+    bool wrap = align & PRINT_WRAP;
+    align &= ~PRINT_WRAP;
+    char *grid = (char *)malloc(w * h + 1);
+    grid[w * h] = '\0';
+    const char *p = txt, *end = txt;
+    int line = 0;
+    bool wrapped = false;
+    while(line < h) {
+        end = strchr(p, '\n');
+        if(end == nullptr)
+            end = p + strlen(p);
+        bool first = true;
+        while(line < h) {
+            if(!first && wrapped)
+                while(p < end && *p == ' ')
+                    p++;
+            if(!first && p == end)
+                break;
+            int len = end - p, n = len < w ? len : w;
+            wrapped = wrap && len > w;
+            if(wrapped && p[w] != ' ') {
+                int k = w - 1;
+                while(k > 0 && !(p[k] == ' ' && p[k - 1] != ' '))
+                    k--;
+                if(k > 0)
+                    n = k;
+            }
+            int adv = n;
+            if(wrapped)
+                while(n > 0 && p[n - 1] == ' ')
+                    n--;
+            int lead = n == w || align == ALIGN_LEFT ? 0 : align == ALIGN_RIGHT ? w - n : (w - n) / 2;
+            for(int i = 0; i < w; i++)
+                grid[line * w + i] = i >= lead && i < lead + n ? p[i - lead] : ' ';
+            p += adv;
+            line++;
+            first = false;
+            if(p == end && !wrapped)
+                break;
+        }
+        if(p == end && *end == '\0') { // everything fit
+            grid[line * w] = '\0';
+            s->AddText(section, grid);
+            free(grid);
+            return 0;
+        }
+        if(line < h || p == end)
+            p = end + 1;
+    }
+    if(wrapped)
+        while(*p == ' ')
+            p++;
+    if(p == end)
+        p = *end == '\0' ? end : end + 1;
+    s->AddText(section, grid);
+    free(grid);
+    return strlen(p);
+}
+
+/* PRINT_WRAP and overflow counts against wrap_ref on random words, spaces and newlines */
+void wrap_test() {
+    sFONT *fonts[] = { &Font8, &Font16, &Font24 };
+    char txt[400];
+    unsigned char line[LINEBYTES], ref[LINEBYTES];
+    int cases = 0, mismatches = 0, overflows = 0;
+    for(int k = 0; k < 20000; k++) {
+        sFONT *font = fonts[k % 3];
+        int h = 1 + rand() % 6;
+        int len = 0, target = rand() % (int)(sizeof(txt) - 40);
+        while(len < target) {
+            int r = rand() % 10;
+            if(r == 0)
+                txt[len++] = '\n';
+            else if(r < 3)
+                txt[len++] = ' ';
+            else
+                for(int n = 1 + rand() % (rand() % 4 ? 8 : 30); n > 0; n--)
+                    txt[len++] = (char)('!' + rand() % 94);
+        }
+        txt[len] = '\0';
+        int align = rand() % 3 | (k % 4 ? PRINT_WRAP : 0);
+        Screen s, r;
+        s.ScreenInit(1);
+        r.ScreenInit(1);
+        s.DefineSection(0, h, font);
+        r.DefineSection(0, h, font);
+        int over = s.Print(0, txt, align);
+        int refOver = wrap_ref(&r, 0, EPD_WIDTH / font->Width, h, txt, align);
+        overflows += over != refOver;
+        for(int row = 0; row < h * font->Height; row++) {
+            s.ComposeLine(row, line);
+            r.ComposeLine(row, ref);
+            mismatches += memcmp(ref, line, LINEBYTES) != 0;
+        }
+        cases++;
+    }
+    // a word longer than a line is split, spaces at the wraps are dropped
+    Screen s;
+    s.ScreenInit(1);
+    s.DefineSection(0, 4, &Font24); // 7 characters
+    char sample[] = "wrap    words supercalifragilistic end";
+    int over = s.Print(0, sample, ALIGN_CENTER | PRINT_WRAP);
+    s.Print();
+    printf("wrap: %d cases, %d mismatched rows, %d wrong overflow counts, sample overflow %d\n", cases, mismatches, overflows, over);
+}
+
+/* proportional fonts against reference lines cut straight from the fixed fonts they were trimmed from,
+ then characters per line for the same sentence in each */
+void prop_test() {
+    sFONT *fixed[] = { &Font8, &Font12, &Font16, &Font20, &Font24 };
+    sFONT *prop[] = { &Font8V, &Font12V, &Font16V, &Font20V, &Font24V };
+    char txt[80], sentence[] = "The quick brown fox jumps over the lazy dog while the band plays on";
+    unsigned char line[LINEBYTES], ref[LINEBYTES];
+    int mismatches = 0, widths = 0, breaks = 0;
+    for(int f = 0; f < 5; f++) {
+        sFONT *font = fixed[f];
+        int bytes = (font->Width + 7) / 8;
+        // ink columns [left, left + ink) of each glyph; blank glyphs advance half a cell
+        int left[95], ink[95], advance[95];
+        for(int c = 0; c < 95; c++) {
+            uint32_t cols = 0;
+            for(int y = 0; y < font->Height; y++)
+                cols |= glyph_row(font->table + (c * font->Height + y) * bytes, font->Width, 0, false);
+            int l = 0, r = font->Width - 1;
+            while(l < font->Width && !((cols >> (font->Width - 1 - l)) & 1))
+                l++;
+            while(r >= l && !((cols >> (font->Width - 1 - r)) & 1))
+                r--;
+            left[c] = l;
+            ink[c] = r - l + 1 > 0 ? r - l + 1 : 0;
+            advance[c] = ink[c] ? ink[c] + 1 : (font->Width + 1) / 2;
+            widths += advance[c] != pgm_read_byte(&prop[f]->Widths[c]);
+        }
+        Screen s;
+        s.ScreenInit(1);
+        s.DefineSection(0, 1, prop[f]);
+        int cells = EPD_WIDTH / prop[f]->Width;
+        for(int k = 0; k < 200; k++) {
+            int len = rand() % (int)(sizeof(txt) - 1);
+            for(int i = 0; i < len; i++)
+                txt[i] = (char)(' ' + rand() % 95);
+            txt[len] = '\0';
+            s.Print(0, txt);
+            for(int y = 0; y < font->Height; y++) {
+                memset(ref, 0, sizeof(ref));
+                int x = 0;
+                for(int i = 0; i < len && i < cells; i++) {
+                    int c = txt[i] - ' ';
+                    if(x + advance[c] > EPD_WIDTH)
+                        break;
+                    uint32_t row = glyph_row(font->table + (c * font->Height + y) * bytes, font->Width, 0, false);
+                    for(int k = 0; k < ink[c]; k++)
+                        if((row >> (font->Width - 1 - left[c] - k)) & 1)
+                            ref[(LINEPAD + x + k) / 8] |= 0x80 >> ((LINEPAD + x + k) % 8);
+                    x += advance[c];
+                }
+                s.ComposeLine(y, line);
+                mismatches += memcmp(ref, line, LINEBYTES) != 0;
+            }
+        }
+        Screen a, b;
+        a.ScreenInit(1);
+        b.ScreenInit(1);
+        a.DefineSection(0, 1, font);
+        b.DefineSection(0, 1, prop[f]);
+        int len = strlen(sentence);
+        int fit = len - a.Print(0, sentence), propFit = len - b.Print(0, sentence);
+        printf("prop: %2dx%-2d %2d characters per line, %2d proportional (%+.0f%%)\n", font->Width, font->Height,
+            fit, propFit, 100.0 * (propFit - fit) / fit);
+
+        // AddText and AppendLine end a line where Print does, before the first glyph past the edge
+        Screen pr, add, app;
+        Screen *all[] = { &pr, &add, &app };
+        for(int k = 0; k < 3; k++) {
+            all[k]->ScreenInit(1);
+            all[k]->DefineSection(0, 2, prop[f]);
+        }
+        snprintf(txt, sizeof(txt), "%s %s", sentence, sentence);
+        breaks += pr.Print(0, txt) != add.AddText(0, txt);
+        app.AppendLine(0, txt);
+        for(int y = 0; y < 2 * font->Height; y++) {
+            pr.ComposeLine(y, ref);
+            add.ComposeLine(y, line);
+            breaks += memcmp(ref, line, LINEBYTES) != 0;
+            if(y < font->Height) {
+                app.ComposeLine(y, line);
+                breaks += memcmp(ref, line, LINEBYTES) != 0;
+            }
+        }
+    }
+
+    // no space to pad with: a font without one, and one whose space has no advance, print unaligned
+    static uint16_t codes[94];
+    static uint8_t widthsNoAdvance[95];
+    for(int c = 0; c < 94; c++)
+        codes[c] = '!' + c;
+    memcpy(widthsNoAdvance, Font8V.Widths, sizeof(widthsNoAdvance));
+    widthsNoAdvance[0] = 0;
+    sFONT noSpace = Font8V, noAdvance = Font8V;
+    noSpace.Widths++;
+    noSpace.Offsets++;
+    noSpace.Codes = codes;
+    noSpace.Count = 94;
+    noAdvance.Widths = widthsNoAdvance;
+    sFONT *spaceless[] = { &noSpace, &noAdvance };
+    int unaligned = 0;
+    for(sFONT *font : spaceless) {
+        char word[] = "right";
+        Screen left, right;
+        left.ScreenInit(1);
+        right.ScreenInit(1);
+        left.DefineSection(0, 1, font);
+        right.DefineSection(0, 1, font);
+        left.Print(0, word);
+        right.Print(0, word, ALIGN_RIGHT);
+        for(int y = 0; y < font->Height; y++) {
+            left.ComposeLine(y, ref);
+            right.ComposeLine(y, line);
+            unaligned += memcmp(ref, line, LINEBYTES) != 0;
+        }
+    }
+    printf("prop: %d mismatched rows, %d wrong advances, %d rows broken unlike Print, %d spaceless rows unlike left aligned\n",
+        mismatches, widths, breaks, unaligned);
+}
+
+/* append the UTF-8 encoding of code to p */
+char *utf8_put(char *p, uint32_t code) {
+    if(code < 0x80) {
+        *p++ = (char)code;
+    } else if(code < 0x800) {
+        *p++ = (char)(0xC0 | code >> 6);
+        *p++ = (char)(0x80 | (code & 0x3F));
+    } else if(code < 0x10000) {
+        *p++ = (char)(0xE0 | code >> 12);
+        *p++ = (char)(0x80 | ((code >> 6) & 0x3F));
+        *p++ = (char)(0x80 | (code & 0x3F));
+    } else {
+        *p++ = (char)(0xF0 | code >> 18);
+        *p++ = (char)(0x80 | ((code >> 12) & 0x3F));
+        *p++ = (char)(0x80 | ((code >> 6) & 0x3F));
+        *p++ = (char)(0x80 | (code & 0x3F));
+    }
+    *p = '\0';
+    return p;
+}
+
+/* rows of two one-line Font8-sized screens that differ */
+int utf8_diff(Screen *a, Screen *b) {
+    unsigned char la[LINEBYTES], lb[LINEBYTES];
+    int rows = 0;
+    for(int y = 0; y < 8; y++) {
+        a->ComposeLine(y, la);
+        b->ComposeLine(y, lb);
+        rows += memcmp(la, lb, LINEBYTES) != 0;
+    }
+    return rows;
+}
+
+/* UTF-8 text through a font with a sparse code point map, fallback glyphs, then lookup cost per character */
+void utf8_test() {
+    // Font8 glyphs under ASCII plus a few code points drawn with look-alikes: degree, micro and right arrow
+    static uint16_t codes[600];
+    static uint8_t table[600 * 8];
+    const char alike[] = "ou>";
+    const uint16_t extra[] = { 0xB0, 0xB5, 0x2192 };
+    int count = 0;
+    for(int c = ' '; c <= '~'; c++, count++) {
+        codes[count] = c;
+        memcpy(table + count * 8, Font8.table + (c - ' ') * 8, 8);
+    }
+    for(int i = 0; i < 3; i++, count++) {
+        codes[count] = extra[i];
+        memcpy(table + count * 8, Font8.table + (alike[i] - ' ') * 8, 8);
+    }
+    sFONT sym = { table, 5, 8, FONT_FORMAT_BYTES, nullptr, nullptr, codes, (uint16_t)count };
+
+    struct { const char *utf8, *ascii; bool symbols; uint32_t fallback; } cases[] = {
+        { "25\xC2\xB0" "C 3\xC2\xB5s a\xE2\x86\x92" "b", "25oC 3us a>b", true, '?' },
+        { "caf\xC3\xA9 \xF0\x9F\x99\x82!", "caf? ?!", true, '?' },      // no glyph for e acute or U+1F642
+        { "caf\xC3\xA9", "caf#", true, '#' },
+        { "25\xC2\xB0" "C", "25?C", false, '?' },                       // plain ASCII font
+        { "a\xFF" "b\xE2\x86" "c\xC0\xAF" "d\x80", "a?b?c?d?", true, '?' }, // stray, truncated, overlong and lone continuation
+    };
+    int failures = 0;
+    for(auto &c : cases) {
+        Screen u, a;
+        u.ScreenInit(1);
+        a.ScreenInit(1);
+        u.DefineSection(0, 1, c.symbols ? &sym : &Font8);
+        a.DefineSection(0, 1, &Font8);
+        u.SetFallback(c.fallback);
+        u.Print(0, (char *)c.utf8, ALIGN_CENTER);
+        a.Print(0, (char *)c.ascii, ALIGN_CENTER);
+        failures += utf8_diff(&u, &a) != 0;
+        u.AppendLine(0, c.utf8);
+        a.AppendLine(0, c.ascii);
+        failures += utf8_diff(&u, &a) != 0;
+        u.AddText(0, (char *)c.utf8);
+        a.AddText(0, (char *)c.ascii);
+        failures += utf8_diff(&u, &a) != 0;
+    }
+
+    // what does not fit is counted in characters, not bytes
+    {
+        Screen u;
+        u.ScreenInit(1);
+        u.DefineSection(0, 1, &sym);
+        char txt[4 * 30 + 1], *p = txt;
+        for(int i = 0; i < 30; i++)
+            p = utf8_put(p, i % 2 ? 0x2192 : 'x');
+        *p = '\0';
+        int over = 30 - EPD_WIDTH / sym.Width;
+        failures += utf8_count(txt) != 30 || u.Print(0, txt) != over || u.AddText(0, txt) != over;
+    }
+
+    // decoder round trip over every code point class
+    int decodeErrors = 0;
+    for(int k = 0; k < 100000; k++) {
+        uint32_t code = rand() % 4 == 0 ? rand() % 0x80 : rand() % 3 == 0 ? rand() % 0x800 : rand() % 2 ? rand() % 0x10000 : 0x10000 + rand() % 0x100000;
+        if(code >= 0xD800 && code < 0xE000)
+            continue;
+        char buf[8], *end = utf8_put(buf, code);
+        uint32_t back;
+        decodeErrors += utf8_next(buf, &back) != end - buf || back != code;
+    }
+
+    // a 500 glyph symbol font: glyph i looks like Font8 glyph i % 95
+    count = 0;
+    for(uint32_t c = 0x2100; count < 500; c += 1 + rand() % 12, count++) {
+        codes[count] = c;
+        memcpy(table + count * 8, Font8.table + (count % 95) * 8, 8);
+    }
+    sFONT big = { table, 5, 8, FONT_FORMAT_BYTES, nullptr, nullptr, codes, 500 };
+    {
+        Screen u, a;
+        u.ScreenInit(1);
+        a.ScreenInit(1);
+        u.DefineSection(0, 1, &big);
+        a.DefineSection(0, 1, &Font8);
+        char txt[64], *p = txt, ascii[8];
+        int glyphs[] = { 7, 254, 300, 499 };
+        for(int g : glyphs)
+            p = utf8_put(p, codes[g]);
+        u.Print(0, txt);
+        for(int i = 0; i < 4; i++)
+            ascii[i] = glyphs[i] < CELL_MAX ? (char)(' ' + glyphs[i] % 95) : ' '; // past 8 bit cells, and no '?' to fall back to
+        ascii[4] = '\0';
+        a.Print(0, ascii);
+        failures += utf8_diff(&u, &a) != 0;
+    }
+
+    sFONT latin = sym;
+    static uint16_t latinCodes[191];
+    for(int c = ' ', i = 0; c <= 0xFF; c++)
+        if(c <= '~' || c >= 0xA0)
+            latinCodes[i++] = c;
+    latin.Codes = latinCodes;
+    latin.Count = 191;
+    const int lookups = 2000000;
+    sFONT *fonts[] = { &latin, &big };
+    for(sFONT *font : fonts) {
+        static char text[lookups / 100 * 4 + 1];
+        char *p = text;
+        for(int i = 0; i < lookups / 100; i++)
+            p = utf8_put(p, pgm_read_word(&font->Codes[rand() % font->Count]));
+        long found = 0;
+        clock_t t = clock();
+        for(int r = 0; r < 100; r++) {
+            for(const char *q = text; *q; ) {
+                uint32_t code;
+                q += utf8_next(q, &code);
+                found += font_glyph_index(font, code) >= 0;
+            }
+        }
+        double secs = (double)(clock() - t) / CLOCKS_PER_SEC;
+        printf("utf8: %3d glyph map, %.1f ns per character decoded and looked up (%ld found)\n", font->Count, secs * 1e9 / lookups, found);
+    }
+    printf("utf8: %d failures, %d decode errors, %d bit cells\n", failures, decodeErrors, (int)sizeof(cell_t) * 8);
+}
+
+/* 2x and 3x sections against a naive upscaler over the same text at 1x, in every font format,
+ then compose rates for scaled sections next to the native font of about the same size */
+void scale_test() {
+    sFONT *fonts[] = { &Font8, &Font12, &Font16, &Font8P, &Font12P, &Font20P, &Font8V, &Font12V, &Font24V };
+    char sample[] = "The quick brown fox jumps over the lazy dog 0123456789 {}[]|~";
+    char txt[2][40];
+    unsigned char line[LINEBYTES], ref[LINEBYTES];
+    int mismatches = 0, cases = 0;
+    for(sFONT *font : fonts) {
+        for(uint8_t scale = 2; scale <= 3; scale++) {
+            if(font->Height * scale * 2 > EPD_HEIGHT)
+                continue;
+            // two lines that fit the scaled section, so the 1x one holds the same glyphs
+            for(int l = 0; l < 2; l++) {
+                int n = 0, used = 0;
+                for(const char *p = sample + l * 7; *p && n < (int)sizeof(txt[l]) - 1; p++, n++) {
+                    int cost = font->Format == FONT_FORMAT_PROP ? cell_advance(font, code_cell(font, *p, '?')) : font->Width;
+                    if((used + cost) * scale > EPD_WIDTH)
+                        break;
+                    used += cost;
+                    txt[l][n] = *p;
+                }
+                txt[l][n] = '\0';
+            }
+            Screen one, big;
+            one.ScreenInit(1);
+            big.ScreenInit(1);
+            one.DefineSection(0, 2, font);
+            big.DefineSection(0, 2, font, scale);
+            char both[81];
+            snprintf(both, sizeof(both), "%s\n%s", txt[0], txt[1]);
+            one.Print(0, both);
+            mismatches += big.Print(0, both) != 0;
+            for(int y = 0; y < font->Height * scale * 2; y++) {
+                int ln = y / (font->Height * scale), sub = y % (font->Height * scale);
+                one.ComposeLine(ln * font->Height + sub / scale, line);
+                memset(ref, 0, LINEBYTES);
+                for(int x = 0; x < EPD_WIDTH; x++) {
+                    int from = LINEPAD + x / scale, to = LINEPAD + x;
+                    if((line[from / 8] >> (7 - from % 8)) & 1)
+                        ref[to / 8] |= 0x80 >> (to % 8);
+                }
+                big.ComposeLine(y, line);
+                mismatches += memcmp(ref, line, LINEBYTES) != 0;
+            }
+            cases++;
+        }
+    }
+
+    // the same screen from DefineSection, a Layout and the panel simulator
+    typedef Layout<LayoutSection<Font12Spec, 1, 3>, LayoutSection<Font8Spec, 2, 2>, LayoutSection<Font8Spec, 4> > Dash;
+    EpdSim sim;
+    Screen dyn(&sim), fixed;
+    dyn.ScreenInit(3);
+    dyn.DefineSection(0, 1, &Font12, 3);
+    dyn.DefineSection(1, 2, &Font8, 2);
+    dyn.DefineSection(2, 4, &Font8);
+    fixed.ScreenInit(Dash::Get());
+    char header[] = "21.5C", body[] = "humid 40%\nwind 12", foot[] = "pressure 1013hPa rising slowly since noon";
+    dyn.Print(0, header, ALIGN_CENTER);
+    fixed.Print(0, header, ALIGN_CENTER);
+    dyn.Print(1, body);
+    fixed.Print(1, body);
+    dyn.AddText(2, foot);
+    fixed.AddText(2, foot);
+    for(int row = 0; row < EPD_HEIGHT; row++) {
+        dyn.ComposeLine(row, ref);
+        fixed.ComposeLine(row, line);
+        mismatches += memcmp(ref, line, LINEBYTES) != 0;
+    }
+    dyn.Draw();
+    char body2[] = "humid 41%\nwind 12";
+    dyn.Print(1, body2);
+    int first, last;
+    dyn.GetDirtyRows(&first, &last);
+    dyn.Draw();
+    int pixels = sim_mismatches(&sim, &dyn);
+    int lines[] = { 1, 2, 4 };
+    sFONT *dashFonts[] = { &Font12, &Font8, &Font8 };
+    uint8_t scales[] = { 3, 2, 1 };
+    printf("scale: %d cases, %d mismatched rows, dirty rows %d..%d, %d mismatched pixels, %d cells vs %d in the layout (%d arena bytes)\n",
+        cases, mismatches, first, last, pixels, (int)(dyn.SectionBytes(-1) - 3 * (sizeof(Section) + 2 * sizeof(void *))) / (int)sizeof(cell_t),
+        Dash::cells, (int)Screen::ArenaBytes(3, lines, dashFonts, scales));
+
+    const int frames = 300;
+    struct { sFONT *font; uint8_t scale; } runs[] = { { &Font12, 1 }, { &Font12, 2 }, { &Font8, 3 }, { &Font24, 1 }, { &Font12V, 2 } };
+    for(auto run : runs) {
+        Screen s;
+        s.ScreenInit(1);
+        s.DefineSection(0, EPD_HEIGHT / (run.font->Height * run.scale), run.font, run.scale);
+        s.AddText(0, sample);
+        clock_t t = clock();
+        for(int f = 0; f < frames; f++)
+            for(int row = 0; row < EPD_HEIGHT; row++)
+                s.ComposeLine(row, line);
+        double secs = (double)(clock() - t) / CLOCKS_PER_SEC;
+        printf("scale: %2dx%-2d at %dx %.0f rows/s\n", run.font->Width, run.font->Height, run.scale, frames * EPD_HEIGHT / secs);
+    }
+}
+
+/* draw a section's text straight from the glyph tables onto a canvas bitmap, one pixel at a time */
+void rotate_ref(uint8_t canvas[][EPD_HEIGHT], int canvasWidth, int top, sFONT *font, int lines, int scale, const char *txt) {
+    bool prop = font->Format == FONT_FORMAT_PROP;
+    int w = canvasWidth / (font->Width * scale), len = strlen(txt), at = 0;
+    for(int ln = 0; ln < lines; ln++) {
+        int x = 0;
+        for(int i = 0; i < w && at < len; i++, at++) {
+            int g = txt[at] - ' ', adv = font->Width;
+            const uint8_t *glyph = font->table + g * font_glyph_bytes(font);
+            if(prop) { // a line ends at the first glyph that does not fit, which starts the next
+                adv = pgm_read_byte(&font->Widths[g]);
+                glyph = font->table + pgm_read_word(&font->Offsets[g]);
+                if(x + adv * scale > canvasWidth)
+                    break;
+            }
+            for(int y = 0; y < font->Height * scale; y++) {
+                uint32_t row = glyph_row(glyph, adv, y / scale, font->Format != FONT_FORMAT_BYTES);
+                for(int k = 0; k < adv * scale; k++)
+                    canvas[top + ln * font->Height * scale + y][x + k] = (row >> (adv - 1 - k / scale)) & 1;
+            }
+            x += adv * scale;
+        }
+    }
+}
+
+/* canvas pixel that panel pixel (px, py) shows in an orientation */
+bool rotate_pixel(uint8_t canvas[][EPD_HEIGHT], int rot, int px, int py) {
+    if(rot == ROTATE_90)
+        return canvas[EPD_WIDTH - 1 - px][py];
+    if(rot == ROTATE_180)
+        return canvas[EPD_HEIGHT - 1 - py][EPD_WIDTH - 1 - px];
+    if(rot == ROTATE_270)
+        return canvas[px][EPD_HEIGHT - 1 - py];
+    return canvas[py][px];
+}
+
+/* every orientation against a naive renderer and pixel rotation: composed rows, the simulated panel
+ after a full and a partial Draw, and golden hashes of the panel image. Then the transpose kernel and
+ compose rate per orientation */
+void rotate_test() {
+    static const uint32_t golden[4] = { 0x9FEA571Cu, 0xB876CCF8u, 0xCF3250BAu, 0xD0A80C3Eu };
+    static uint8_t canvas[EPD_HEIGHT][EPD_HEIGHT];
+    char head[] = "12:45", body[] = "Kitchen 21.5C Garage 8.0C Attic 27.5C Cellar 12.0C, all sensors reporting normally",
+        foot[] = "Next: bins out Thursday 07:00", body2[] = "Kitchen 19.0C Garage 8.0C";
+    int failures = 0, mismatches = 0;
+    unsigned char line[LINEBYTES];
+    for(int rot = ROTATE_0; rot <= ROTATE_270; rot++) {
+        bool landscape = rot == ROTATE_90 || rot == ROTATE_270;
+        int cw = landscape ? EPD_HEIGHT : EPD_WIDTH;
+        EpdSim sim;
+        Screen s(&sim);
+        s.ScreenInit(3);
+        failures += s.SetRotation(rot) != 0;
+        s.DefineSection(0, 1, &Font12, 2);
+        s.DefineSection(1, 3, &Font8V);
+        s.DefineSection(2, 2, &Font16P);
+        s.AddText(0, head);
+        s.AddText(1, body);
+        s.AddText(2, foot);
+        uint32_t hash = 2166136261u; // FNV-1a over the expected panel rows
+        for(int pass = 0; pass < 2; pass++) {
+            memset(canvas, 0, sizeof(canvas));
+            rotate_ref(canvas, cw, 0, &Font12, 1, 2, head);
+            rotate_ref(canvas, cw, 24, &Font8V, 3, 1, pass ? body2 : body);
+            rotate_ref(canvas, cw, 48, &Font16P, 2, 1, foot);
+            // composed rows, then the panel after a full Draw (first pass) or a partial one
+            s.Draw();
+            for(int py = 0; py < EPD_HEIGHT; py++) {
+                s.ComposeLine(py, line);
+                for(int px = 0; px < EPD_WIDTH; px++) {
+                    bool want = rotate_pixel(canvas, rot, px, py);
+                    int bit = LINEPAD + px;
+                    mismatches += want != (bool)((line[bit / 8] >> (7 - bit % 8)) & 1);
+                    mismatches += want != sim.Pixel(px, py);
+                    if(pass == 0)
+                        hash = (hash ^ want) * 16777619u;
+                }
+            }
+            if(pass == 0) {
+                s.AddText(1, body2);
+                int first, last;
+                s.GetDirtyRows(&first, &last);
+                failures += rot == ROTATE_0 ? first != 24 || last != 47 : rot == ROTATE_180 ? first != EPD_HEIGHT - 48 || last != EPD_HEIGHT - 25
+                    : first != 0 || last != EPD_HEIGHT - 1;
+            }
+        }
+        // the cursor walks canvas rows, which need CANVASBYTES in landscape
+        unsigned char row[CANVASBYTES + 1];
+        RowCursor at;
+        s.SeekRow(0, &at);
+        row[LINEBYTES] = 0xA5;
+        failures += s.ComposeNext(&at, row) != landscape || row[LINEBYTES] != 0xA5;
+        s.SeekRow(0, &at);
+        for(int y = 0; y < (landscape ? EPD_WIDTH : EPD_HEIGHT); y++) {
+            failures += s.ComposeNext(&at, row, CANVASBYTES) != 0;
+            for(int x = 0; x < cw; x++) {
+                int bit = LINEPAD + x;
+                mismatches += (bool)canvas[y][x] != (bool)((row[bit / 8] >> (7 - bit % 8)) & 1);
+            }
+        }
+        failures += hash != golden[rot];
+        printf("rotate: %3d° %dx%d canvas, image %08X%s, %d+%d refreshes\n", rot * 90, cw, landscape ? EPD_WIDTH : EPD_HEIGHT,
+            (unsigned int)hash, hash == golden[rot] ? "" : " (NOT GOLDEN)", sim.stats.fullRefreshes, sim.stats.partialRefreshes);
+    }
+    Screen fixed;
+    fixed.ScreenInit(Layout<LayoutSection<Font8Spec, 2> >::Get());
+    failures += fixed.SetRotation(ROTATE_90) != 1 || fixed.SetRotation(ROTATE_180) != 0;
+
+    // transpose kernel against a bit at a time
+    const int blocks = 4000000;
+    static uint8_t in[4096 + 8];
+    for(unsigned int i = 0; i < sizeof(in); i++)
+        in[i] = (uint8_t)rand();
+    uint8_t out[8], ref[8];
+    for(int i = 0; i < 4096; i += 8) {
+        transpose8(in + i, out);
+        memset(ref, 0, 8);
+        for(int r = 0; r < 8; r++)
+            for(int c = 0; c < 8; c++)
+                ref[r] |= ((in[i + c] >> (7 - r)) & 1) << (7 - c);
+        failures += memcmp(out, ref, 8) != 0;
+    }
+    volatile uint8_t sink = 0;
+    clock_t t = clock();
+    for(int b = 0; b < blocks; b++) {
+        transpose8(in + (b & 4095), out);
+        sink = sink + out[b & 7];
+    }
+    double fast = (double)(clock() - t) / CLOCKS_PER_SEC;
+    t = clock();
+    for(int b = 0; b < blocks; b++) {
+        const uint8_t *blk = in + (b & 4095);
+        memset(ref, 0, 8);
+        for(int r = 0; r < 8; r++)
+            for(int c = 0; c < 8; c++)
+                ref[r] |= ((blk[c] >> (7 - r)) & 1) << (7 - c);
+        sink = sink + ref[b & 7];
+    }
+    double slow = (double)(clock() - t) / CLOCKS_PER_SEC;
+    printf("rotate: transpose8 %.1f ns per block, bit loop %.1f ns\n", fast * 1e9 / blocks, slow * 1e9 / blocks);
+
+    // whole frames through the simulator, which decodes the same bytes for every orientation
+    const int frames = 100;
+    for(int rot = ROTATE_0; rot <= ROTATE_270; rot++) {
+        EpdSim sim;
+        Screen s(&sim);
+        s.ScreenInit(2);
+        s.SetRotation(rot);
+        s.DefineSection(0, 2, &Font12, 2);
+        s.DefineSection(1, 8, &Font8);
+        s.AddText(0, body);
+        s.AddText(1, body);
+        s.Draw();
+        sim.ResetStats();
+        t = clock();
+        for(int f = 0; f < frames; f++) {
+            s.AddText(0, f % 2 ? body : body2);
+            s.Draw();
+        }
+        double secs = (double)(clock() - t) / CLOCKS_PER_SEC;
+        long rows = sim.stats.ramBytes / LINEBYTES;
+        printf("rotate: %3d° %3ld rows per update, %.0f rows/s sent\n", rot * 90, rows / frames, rows / secs);
+    }
+    printf("rotate: %d failures, %d mismatched pixels\n", failures, mismatches);
+    (void)sink;
+}
+
+/* plot a shape into a canvas bitmap the slow way, lines by the textbook Bresenham loop */
+void shape_ref(uint8_t canvas[][EPD_HEIGHT], int top, uint8_t kind, int x0, int y0, int x1, int y1, uint8_t value) {
+    if(kind == SHAPE_HLINE)
+        y1 = y0;
+    if(kind == SHAPE_VLINE)
+        x1 = x0;
+    if(kind == SHAPE_LINE) {
+        int dx = abs(x1 - x0), dy = abs(y1 - y0);
+        if(dx >= dy ? x0 > x1 : y0 > y1) { // drawn from the left, or for steep lines the top
+            int t = x0; x0 = x1; x1 = t;
+            t = y0; y0 = y1; y1 = t;
+        }
+        int sx = x1 > x0 ? 1 : -1, sy = y1 > y0 ? 1 : -1;
+        if(dx >= dy) {
+            int err = dx / 2, y = y0;
+            for(int x = x0; x <= x1; x++) {
+                canvas[top + y][x] = 1;
+                err -= dy;
+                if(err < 0) {
+                    y += sy;
+                    err += dx;
+                }
+            }
+        } else {
+            int err = dy / 2, x = x0;
+            for(int y = y0; y <= y1; y++) {
+                canvas[top + y][x] = 1;
+                err -= dx;
+                if(err < 0) {
+                    x += sx;
+                    err += dy;
+                }
+            }
+        }
+        return;
+    }
+    if(x0 > x1) {
+        int t = x0; x0 = x1; x1 = t;
+    }
+    if(y0 > y1) {
+        int t = y0; y0 = y1; y1 = t;
+    }
+    for(int y = y0; y <= y1; y++) {
+        for(int x = x0; x <= x1; x++) {
+            bool edge = y == y0 || y == y1 || x == x0 || x == x1;
+            bool filled = kind == SHAPE_BAR && x1 > x0 + 1 && x - x0 <= (x1 - x0 - 1) * value / 255;
+            if(kind != SHAPE_RECT && kind != SHAPE_BAR ? true : edge || filled)
+                canvas[top + y][x] = 1;
+        }
+    }
+}
+
+/* graphics sections against shape_ref: random display lists in portrait and landscape, a dashboard
+ through the simulator with a gauge update, golden hashes, then rows/s by display list length */
+void graphics_test() {
+    static const uint32_t golden[2] = { 0x1DAAFC8Fu, 0x83422490u };
+    static uint8_t canvas[EPD_HEIGHT][EPD_HEIGHT];
+    unsigned char line[LINEBYTES];
+    int failures = 0, mismatches = 0, cases = 0;
+    for(int rot = ROTATE_0; rot <= ROTATE_90; rot++) {
+        int cw = rot == ROTATE_90 ? EPD_HEIGHT : EPD_WIDTH, ch = rot == ROTATE_90 ? EPD_WIDTH : EPD_HEIGHT;
+        for(int k = 0; k < 300; k++) {
+            Screen s;
+            s.ScreenInit(2);
+            s.SetRotation(rot);
+            int rows = 1 + rand() % (ch - 8);
+            s.DefineSection(0, 1, &Font8);
+            s.DefineGraphics(1, rows, 24);
+            memset(canvas, 0, sizeof(canvas));
+            int n = rand() % 25;
+            for(int i = 0; i < n; i++) {
+                uint8_t kind = rand() % (SHAPE_BAR + 1), value = rand() % 256;
+                int x0 = rand() % cw, x1 = rand() % cw, y0 = rand() % rows, y1 = rand() % rows;
+                int d = rand() % 5;
+                if(rand() % 4 == 0) // short ones too
+                    x1 = x0 + d < cw ? x0 + d : cw - 1;
+                failures += s.AddShape(1, kind, x0, y0, x1, y1, value) != i;
+                shape_ref(canvas, 8, kind, x0, y0, x1, y1, value);
+            }
+            for(int py = 0; py < EPD_HEIGHT; py++) {
+                s.ComposeLine(py, line);
+                for(int px = 0; px < EPD_WIDTH; px++) {
+                    int bit = LINEPAD + px;
+                    bool got = (line[bit / 8] >> (7 - bit % 8)) & 1;
+                    if(rot == ROTATE_90 ? EPD_WIDTH - 1 - px >= 8 : py >= 8) // below the text line
+                        mismatches += got != rotate_pixel(canvas, rot, px, py);
+                }
+            }
+            failures += s.AddShape(1, SHAPE_FILL, 0, 0, 1, 1) != (n == 24 ? -1 : n); // only 24 fit
+            cases++;
+        }
+    }
+
+    // a dashboard: title, a gauge that moves, axes and a trend line
+    uint32_t hash[2] = { 2166136261u, 2166136261u };
+    for(int rot = ROTATE_0; rot <= ROTATE_90; rot++) {
+        int cw = rot == ROTATE_90 ? EPD_HEIGHT : EPD_WIDTH;
+        EpdSim sim;
+        Screen s(&sim);
+        s.ScreenInit(2);
+        s.SetRotation(rot);
+        s.DefineSection(0, 1, &Font16);
+        s.DefineGraphics(1, 100, 8);
+        char title[] = "Tank";
+        s.AddText(0, title);
+        memset(canvas, 0, sizeof(canvas));
+        int gauge = s.AddShape(1, SHAPE_BAR, 2, 2, cw - 3, 14, 160);
+        s.AddShape(1, SHAPE_VLINE, 4, 20, 4, 96);
+        s.AddShape(1, SHAPE_HLINE, 4, 96, cw - 4, 96);
+        s.AddShape(1, SHAPE_LINE, 5, 90, cw - 6, 30);
+        s.AddShape(1, SHAPE_RECT, cw - 20, 40, cw - 8, 60);
+        s.AddShape(1, SHAPE_FILL, cw - 17, 43, cw - 11, 57);
+        s.Draw();
+        s.SetShape(1, gauge, SHAPE_BAR, 2, 2, cw - 3, 14, 200);
+        int first, last;
+        s.GetDirtyRows(&first, &last);
+        failures += rot == ROTATE_0 && (first != 16 + 2 || last != 16 + 14);
+        s.Draw();
+        shape_ref(canvas, 16, SHAPE_BAR, 2, 2, cw - 3, 14, 200);
+        shape_ref(canvas, 16, SHAPE_VLINE, 4, 20, 4, 96, 0);
+        shape_ref(canvas, 16, SHAPE_HLINE, 4, 96, cw - 4, 96, 0);
+        shape_ref(canvas, 16, SHAPE_LINE, 5, 90, cw - 6, 30, 0);
+        shape_ref(canvas, 16, SHAPE_RECT, cw - 20, 40, cw - 8, 60, 0);
+        shape_ref(canvas, 16, SHAPE_FILL, cw - 17, 43, cw - 11, 57, 0);
+        for(int py = 0; py < EPD_HEIGHT; py++) {
+            for(int px = 0; px < EPD_WIDTH; px++) {
+                bool graphic = rot == ROTATE_90 ? EPD_WIDTH - 1 - px >= 16 : py >= 16;
+                if(graphic)
+                    mismatches += sim.Pixel(px, py) != rotate_pixel(canvas, rot, px, py);
+                hash[rot] = (hash[rot] ^ sim.Pixel(px, py)) * 16777619u;
+            }
+        }
+        failures += hash[rot] != golden[rot];
+        printf("graphics: %3d° dashboard %08X%s, 8 shapes in %d bytes, %d+%d refreshes\n", rot * 90, (unsigned int)hash[rot],
+            hash[rot] == golden[rot] ? "" : " (NOT GOLDEN)", (int)s.SectionBytes(1), sim.stats.fullRefreshes, sim.stats.partialRefreshes);
+    }
+
+    // bars across the landscape canvas, whose fill width times value passes 16 bits
+    Screen bars;
+    bars.ScreenInit(1);
+    bars.SetRotation(ROTATE_90);
+    bars.DefineGraphics(0, EPD_WIDTH, 1);
+    int bar = bars.AddShape(0, SHAPE_BAR, 0, 0, EPD_HEIGHT - 1, EPD_WIDTH - 1);
+    for(int value = 0; value < 256; value += 17) {
+        failures += bars.SetShape(0, bar, SHAPE_BAR, 0, 0, EPD_HEIGHT - 1, EPD_WIDTH - 1, value) != 0;
+        memset(canvas, 0, sizeof(canvas));
+        shape_ref(canvas, 0, SHAPE_BAR, 0, 0, EPD_HEIGHT - 1, EPD_WIDTH - 1, value);
+        for(int py = 0; py < EPD_HEIGHT; py++) {
+            bars.ComposeLine(py, line);
+            for(int px = 0; px < EPD_WIDTH; px++) {
+                int bit = LINEPAD + px;
+                mismatches += (bool)((line[bit / 8] >> (7 - bit % 8)) & 1) != rotate_pixel(canvas, ROTATE_90, px, py);
+            }
+        }
+        cases++;
+    }
+
+    const int frames = 200;
+    int counts[] = { 8, 32, 128 };
+    for(int shapes : counts) {
+        Screen s;
+        s.ScreenInit(1);
+        s.DefineGraphics(0, EPD_HEIGHT, shapes);
+        for(int i = 0; i < shapes; i++)
+            s.AddShape(0, i % (SHAPE_BAR + 1), rand() % EPD_WIDTH, rand() % EPD_HEIGHT, rand() % EPD_WIDTH, rand() % EPD_HEIGHT, rand() % 256);
+        clock_t t = clock();
+        for(int f = 0; f < frames; f++)
+            for(int row = 0; row < EPD_HEIGHT; row++)
+                s.ComposeLine(row, line);
+        double secs = (double)(clock() - t) / CLOCKS_PER_SEC;
+        printf("graphics: %3d shapes %5d bytes (framebuffer %d), %.0f rows/s\n", shapes, (int)s.SectionBytes(0),
+            EPD_HEIGHT * LINEBYTES, frames * EPD_HEIGHT / secs);
+    }
+    printf("graphics: %d cases, %d failures, %d mismatched pixels\n", cases, failures, mismatches);
+}
+
+/* chart sections against plotting the last samples from scratch: random series, capacities, heights and
+ styles in portrait and landscape, then append cost for noisy and steadily rising data and render rate */
+void chart_test() {
+    static uint8_t canvas[EPD_HEIGHT][EPD_HEIGHT];
+    static int series[600];
+    unsigned char line[LINEBYTES];
+    int failures = 0, mismatches = 0, cases = 0;
+    for(int rot = ROTATE_0; rot <= ROTATE_90; rot++) {
+        int cw = rot == ROTATE_90 ? EPD_HEIGHT : EPD_WIDTH, ch = rot == ROTATE_90 ? EPD_WIDTH : EPD_HEIGHT;
+        for(int k = 0; k < 40; k++) {
+            Screen s;
+            s.ScreenInit(2);
+            s.SetRotation(rot);
+            int rows = 1 + rand() % (ch - 12), cap = 1 + rand() % (cw + 20), held = cap < cw ? cap : cw;
+            uint8_t style = rand() % 2;
+            s.DefineSection(0, 1, &Font12);
+            s.DefineChart(1, rows, cap, style);
+            int n = rand() % 400, v = rand() % 2000 - 1000;
+            bool full = k % 8 == 0; // samples over the whole int16 range, so hi - lo passes 16 bits
+            for(int i = 0; i < n; i++) {
+                v += rand() % 3 == 0 ? rand() % 401 - 200 : rand() % 21 - 10;
+                if(full)
+                    v = i % 2 ? INT16_MAX - rand() % 100 : INT16_MIN + rand() % 65536;
+                series[i] = v;
+                failures += s.AddSample(1, v);
+                if(i % 37 != 0 && i != n - 1)
+                    continue;
+                // the last held samples, plotted from scratch
+                int count = i + 1 < held ? i + 1 : held, first = i + 1 - count, lo = series[first], hi = lo;
+                for(int j = first; j <= i; j++) {
+                    lo = series[j] < lo ? series[j] : lo;
+                    hi = series[j] > hi ? series[j] : hi;
+                }
+                int gotLo, gotHi;
+                failures += s.GetChartRange(1, &gotLo, &gotHi) != 0 || gotLo != lo || gotHi != hi;
+                memset(canvas, 0, sizeof(canvas));
+                int prev = -1;
+                for(int j = first; j <= i; j++) {
+                    int y = hi == lo ? (rows - 1) / 2 : (rows - 1) - (series[j] - lo) * (rows - 1) / (hi - lo);
+                    int x = cw - (i + 1 - j);
+                    int top = style == CHART_BARS ? y : prev < 0 || prev > y ? y : prev;
+                    int bottom = style == CHART_BARS ? rows - 1 : prev < 0 || prev < y ? y : prev;
+                    for(int r = top; r <= bottom; r++)
+                        canvas[12 + r][x] = 1;
+                    prev = y;
+                }
+                for(int py = 0; py < EPD_HEIGHT; py++) {
+                    s.ComposeLine(py, line);
+                    for(int px = 0; px < EPD_WIDTH; px++) {
+                        int bit = LINEPAD + px;
+                        if(rot == ROTATE_90 ? EPD_WIDTH - 1 - px >= 12 : py >= 12)
+                            mismatches += (bool)((line[bit / 8] >> (7 - bit % 8)) & 1) != rotate_pixel(canvas, rot, px, py);
+                    }
+                }
+                cases++;
+            }
+        }
+    }
+    Screen d;
+    d.ScreenInit(2);
+    d.DefineSection(0, 1, &Font12);
+    d.DefineChart(1, 60, EPD_WIDTH, CHART_BARS);
+    d.Draw();
+    d.AddSample(1, 5);
+    int first, last;
+    d.GetDirtyRows(&first, &last);
+    failures += first != 12 || last != 71 || d.AddSample(0, 1) != 1 || d.SectionBytes(1) != sizeof(Section) + sizeof(ChartHeader) + 3 * EPD_WIDTH + 2 * sizeof(void *);
+
+    const int appends = 2000000;
+    const char *kinds[] = { "noisy", "rising" };
+    for(int kind = 0; kind < 2; kind++) {
+        Screen s;
+        s.ScreenInit(1);
+        s.DefineChart(0, 100, EPD_WIDTH);
+        int v = 0;
+        clock_t t = clock();
+        for(int i = 0; i < appends; i++) {
+            v = kind ? (v + 1) & 0x7FFF : v + rand() % 21 - 10; // rising: the lowest sample leaves every time
+            s.AddSample(0, v);
+        }
+        double secs = (double)(clock() - t) / CLOCKS_PER_SEC;
+        printf("chart: %-6s %.1f ns per sample added\n", kinds[kind], secs * 1e9 / appends);
+    }
+    const int frames = 300;
+    for(uint8_t style = CHART_LINE; style <= CHART_BARS; style++) {
+        Screen s;
+        s.ScreenInit(1);
+        s.DefineChart(0, EPD_HEIGHT, EPD_WIDTH, style);
+        for(int i = 0; i < EPD_WIDTH * 2; i++)
+            s.AddSample(0, rand() % 1000);
+        clock_t t = clock();
+        for(int f = 0; f < frames; f++)
+            for(int row = 0; row < EPD_HEIGHT; row++)
+                s.ComposeLine(row, line);
+        double secs = (double)(clock() - t) / CLOCKS_PER_SEC;
+        printf("chart: %-6s %.0f rows/s, %d bytes for %d samples\n", style == CHART_BARS ? "bars" : "line",
+            frames * EPD_HEIGHT / secs, (int)s.SectionBytes(0), EPD_WIDTH);
+    }
+    printf("chart: %d cases, %d failures, %d mismatched pixels\n", cases, failures, mismatches);
+}
+
+/* test picture with no symmetry, so flipped or shifted rows show up */
+bool image_pixel(int x, int y) {
+    return (x * 3 + y * 5) % 11 < 3 || x < y / 4;
+}
+
+/* a P4 file of rows of the test picture, with garbage in the pad bits; returns its length */
+int image_pbm(uint8_t *out, int rows, const char *header) {
+    int n = strlen(header);
+    memcpy(out, header, n);
+    for(int y = 0; y < rows; y++) {
+        for(int xb = 0; xb < LINEBYTES; xb++) {
+            uint8_t byte = 0;
+            for(int b = 0; b < 8; b++) {
+                int x = xb * 8 + b;
+                if(x >= EPD_WIDTH ? (x + y) % 3 == 0 : image_pixel(x, y))
+                    byte |= 0x80 >> b;
+            }
+            out[n++] = byte;
+        }
+    }
+    return n;
+}
+
+/* pixels of panel rows [top, top + rows) that differ from picture rows from picture row first on */
+int image_mismatches(EpdSim *sim, int top, int rows, int first) {
+    int mismatches = 0;
+    for(int y = 0; y < rows; y++)
+        for(int x = 0; x < EPD_WIDTH; x++)
+            mismatches += sim->Pixel(x, top + y) != (first + y >= 0 && image_pixel(x, first + y));
+    return mismatches;
+}
+
+/*
+A picture sent over a UART at baud into a 64 byte receive buffer, the sketch granting the host
+credit for one IMAGE_CHUNK at a time as it passes bytes to PushImage. The panel is still refreshing
+the previous draw when the image starts. Device time is the bus time plus the time spent waiting.
+Returns the bytes lost to a full buffer; without credits the host sends at once. *wait is the
+time before the panel took the image and *us the time from then until EndImage.
+*/
+#define IMAGE_RX 64
+#define IMAGE_CHUNK 32
+long image_serial(EpdSim *sim, Screen *s, int section, const uint8_t *data, int n, long baud, bool credits, double *wait, double *us) {
+    static double arrive[8192];
+    double byteUs = 10e6 / baud, now = 0, wireFree = 0;
+    int sent = 0, read = 0, granted = credits ? 0 : n;
+    long overrun = 0;
+    unsigned long micros = sim->transfer.micros;
+    if(!credits) // the host does not wait
+        for(; sent < n; sent++)
+            arrive[sent] = wireFree = wireFree + byteUs;
+    while(s->BeginImage(section, IMAGE_PBM)) {
+        sim->Delay(EPD_POLL_MS);
+        now += EPD_POLL_MS * 1000;
+    }
+    *wait = now;
+    if(credits)
+        granted = IMAGE_RX; // one credit per chunk the receive buffer has room for
+    double creditAt = now + byteUs;
+    int left = 1;
+    while(left > 0) {
+        for(; sent < granted && sent < n; sent++) {
+            double start = wireFree > creditAt ? wireFree : creditAt;
+            arrive[sent] = wireFree = start + byteUs;
+        }
+        int ready = read;
+        while(ready < sent && arrive[ready] <= now)
+            ready++;
+        if(ready == read) {
+            if(read == sent)
+                break;
+            now = arrive[read];
+            continue;
+        }
+        int take = ready - read < IMAGE_RX ? ready - read : IMAGE_RX;
+        if(!credits && ready - read > IMAGE_RX) // the bytes after a full buffer are lost
+            overrun += ready - read - IMAGE_RX;
+        left = s->PushImage(data + read, take);
+        int before = read / IMAGE_CHUNK;
+        read = credits ? read + take : ready;
+        now += sim->transfer.micros - micros;
+        micros = sim->transfer.micros;
+        if(credits && read / IMAGE_CHUNK > before) {
+            granted += (read / IMAGE_CHUNK - before) * IMAGE_CHUNK;
+            creditAt = now + byteUs;
+        }
+    }
+    s->EndImage();
+    now += sim->transfer.micros - micros;
+    *us = now - *wait;
+    return overrun;
+}
+
+void image_test() {
+    static uint8_t pbm[8192];
+    int failures = 0, mismatches = 0;
+    const char *header = "P4\n# test picture\n122 250\n";
+    int n = image_pbm(pbm, EPD_HEIGHT, header);
+    const long bauds[] = { 115200, 1000000 };
+    for(int i = 0; i < 2; i++) {
+        for(int credits = 1; credits >= 0; credits--) {
+            EpdSim sim;
+            Screen s(&sim);
+            s.ScreenInit(1);
+            s.DefineImage(0, EPD_HEIGHT);
+            s.DrawAsync(); // the image arrives during the first full refresh
+            double wait, us;
+            long overrun = image_serial(&sim, &s, 0, pbm, n, bauds[i], credits, &wait, &us);
+            unsigned long ms = sim.Millis();
+            s.Draw();
+            if(!credits) {
+                printf("image: %7ld baud without flow control, %ld of %d bytes lost while the panel was busy\n", bauds[i], overrun, n);
+                continue;
+            }
+            mismatches += image_mismatches(&sim, 0, EPD_HEIGHT, 0);
+            failures += overrun != 0;
+            printf("image: %7ld baud, %d bytes in %.0f ms after %.0f ms busy (%.1f KB/s, %.0f rows/s, wire %.0f ms), %lu ms refresh, %ld lost\n",
+                bauds[i], n, us / 1000, wait / 1000, n / us * 1e3, EPD_HEIGHT / us * 1e6, n * 10e3 / bauds[i], sim.Millis() - ms, overrun);
+        }
+    }
+
+    // a picture between two text sections; text draws go around it
+    EpdSim sim;
+    Screen s(&sim);
+    char top[] = "top", bottom[] = "bottom\nsection\nhere", later[] = "later";
+    int rows = 200, base = Font12.Height;
+    s.ScreenInit(3);
+    s.DefineSection(0, 1, &Font12);
+    failures += s.DefineImage(1, rows);
+    s.DefineSection(2, 3, &Font12);
+    s.Print(0, top);
+    s.Print(2, bottom);
+    s.Draw();
+    mismatches += sim_mismatches(&sim, &s);
+    const char *tall = "P4 122\n#taller than the section\n230\n";
+    n = image_pbm(pbm, 230, tall);
+    failures += s.BeginImage(0) != 1 || s.BeginImage(1, IMAGE_PBM) != 0 || s.BeginImage(1) != 1 || s.DrawAsync() != 1;
+    sim.ResetStats();
+    int left = 0;
+    for(int at = 0; at < n; ) {
+        int len = 1 + rand() % 40;
+        len = at + len > n ? n - at : len;
+        left = s.PushImage(pbm + at, len);
+        at += len;
+        failures += at > 40 && left != n - at;
+    }
+    failures += left != 0 || s.EndImage() != 0 || s.EndImage() != 1 || sim.stats.ramBytes != rows * LINEBYTES;
+    s.Draw();
+    failures += sim.stats.partialRefreshes != 1;
+    mismatches += image_mismatches(&sim, base, rows, 0);
+
+    s.Print(0, later);
+    s.Print(2, later);
+    sim.ResetStats();
+    s.Draw();
+    failures += sim.stats.ramBytes != (base + 3 * Font12.Height) * LINEBYTES;
+    mismatches += image_mismatches(&sim, base, rows, 0);
+    s.Reset(); // full refresh, the picture stays in panel RAM
+    s.Draw();
+    mismatches += image_mismatches(&sim, base, rows, 0);
+    for(int y = 0; y < EPD_HEIGHT; y++) // text rows
+        if(y < base || y >= base + rows) {
+            unsigned char line[LINEBYTES];
+            s.ComposeLine(y, line);
+            for(int x = 0; x < EPD_WIDTH; x++)
+                mismatches += sim.Pixel(x, y) != (bool)((line[(x + LINEPAD) / 8] >> (7 - (x + LINEPAD) % 8)) & 1);
+        }
+
+    // raw rows stopping part way, then a header that is refused: uncovered rows are blank
+    failures += s.BeginImage(1) != 0 || s.PushImage(pbm + strlen(tall), 100 * LINEBYTES + 5) != (rows - 100) * LINEBYTES - 5;
+    s.EndImage();
+    s.Draw();
+    mismatches += image_mismatches(&sim, base, 100, 0) + image_mismatches(&sim, base + 101, rows - 101, -EPD_HEIGHT);
+    const uint8_t wide[] = "P4 128 250\n";
+    failures += s.BeginImage(1, IMAGE_PBM) != 0 || s.PushImage(wide, sizeof(wide) - 1) != -1 || s.PushImage(pbm, 16) != -1;
+    s.EndImage();
+    s.Draw();
+    mismatches += image_mismatches(&sim, base, rows, -EPD_HEIGHT);
+    failures += s.Print(1, top) == 0 || s.SectionBytes(1) != sizeof(Section) + 2 * sizeof(void *);
+
+    // a picture shown by a fast refresh is in 0x26 as well, so the next partial refresh leaves it be
+    RefreshLimits clears = { 0, 1, 0, 255 };
+    s.SetRefreshPolicy(refresh_limits, &clears);
+    s.BeginImage(1);
+    s.PushImage(pbm + strlen(tall), rows * LINEBYTES);
+    s.EndImage();
+    sim.ResetStats();
+    s.Draw();
+    failures += sim.stats.fullRefreshes != 1 || sim.stats.lastFrames != 30 || !sim.RamsMatch(0, EPD_HEIGHT - 1);
+    s.SetRefreshPolicy(refresh_limits);
+    s.Print(0, top);
+    sim.ResetStats();
+    s.Draw();
+    failures += sim.stats.partialRefreshes != 1 || sim.stats.ghostMax != 1 || !sim.RamsMatch(0, EPD_HEIGHT - 1);
+    mismatches += image_mismatches(&sim, base, rows, 0);
+
+    // the first draw of a new layout blanks its image rows
+    s.BeginImage(1);
+    s.PushImage(pbm + strlen(tall), rows * LINEBYTES);
+    s.EndImage();
+    s.Draw();
+    Screen t(&sim);
+    t.ScreenInit(1);
+    t.DefineImage(0, EPD_HEIGHT);
+    t.Draw();
+    mismatches += image_mismatches(&sim, 0, EPD_HEIGHT, -EPD_HEIGHT);
+    Screen r;
+    r.ScreenInit(1);
+    r.SetRotation(ROTATE_90);
+    failures += r.DefineImage(0, 10) != 1;
+    printf("image: %d failures, %d mismatched pixels\n", failures, mismatches);
+}
+
+/* wrap records in a frame the way tools/screenlink.py does, returns its length */
+int link_frame(uint8_t *out, uint8_t seq, const uint8_t *records, int len) {
+    uint16_t crc = 0xFFFF;
+    out[0] = LINK_SOF;
+    out[1] = seq;
+    out[2] = len;
+    memcpy(out + 3, records, len);
+    for(int i = 1; i < 3 + len; i++)
+        crc = link_crc(crc, out[i]);
+    out[3 + len] = crc & 0xFF;
+    out[4 + len] = crc >> 8;
+    return len + 5;
+}
+
+/* add a record to records holding len bytes, returns the new length */
+int link_record(uint8_t *records, int len, uint8_t op, const void *args, int n) {
+    records[len] = op;
+    records[len + 1] = n;
+    if(n > 0)
+        memcpy(records + len + 2, args, n);
+    return len + 2 + n;
+}
+
+/* a text record: section, align, then the text */
+int link_text(uint8_t *records, int len, uint8_t op, int section, int align, const char *txt) {
+    uint8_t args[LINK_MAX_BODY];
+    int n = 0;
+    args[n++] = section;
+    if(op == LINK_PRINT)
+        args[n++] = align;
+    memcpy(args + n, txt, strlen(txt));
+    return link_record(records, len, op, args, n + strlen(txt));
+}
+
+/* feed a frame to the link, returns the answer's first byte (0 if none) and its reason in *reason */
+int link_send(ScreenLink *l, const uint8_t *frame, int n, int *reason) {
+    uint8_t reply[LINK_REPLY_BYTES];
+    int answer = 0;
+    *reason = 0;
+    for(int i = 0; i < n; i++) {
+        size_t got = l->Receive(frame[i], reply);
+        if(got > 0) {
+            answer = reply[0];
+            *reason = got > 2 ? reply[2] : 0;
+        }
+    }
+    return answer;
+}
+
+/* panel rows two screens compose differently */
+int screen_diff(Screen *a, Screen *b) {
+    unsigned char la[LINEBYTES], lb[LINEBYTES];
+    int rows = 0;
+    for(int y = 0; y < EPD_HEIGHT; y++) {
+        a->ComposeLine(y, la);
+        b->ComposeLine(y, lb);
+        rows += memcmp(la, lb, LINEBYTES) != 0;
+    }
+    return rows;
+}
+
+/* text, log, graphics and chart sections above a picture */
+void link_layout(Screen *s) {
+    s->ScreenInit(5);
+    s->DefineSection(0, 2, &Font12);
+    s->DefineSection(1, 3, &Font8);
+    s->DefineGraphics(2, 20, 4);
+    s->DefineChart(3, 30, 60);
+    s->DefineImage(4, 140);
+}
+
+/* frames against the same calls made directly, then corrupted, repeated, malformed and refused frames */
+void link_test() {
+    EpdSim sim;
+    Screen s(&sim), ref;
+    ScreenLink l(&s);
+    uint8_t records[LINK_MAX_BODY + 8], frame[LINK_MAX_BODY + 16];
+    int failures = 0, diffs = 0, reason, n, len;
+    uint8_t seq = 0;
+    link_layout(&s);
+    link_layout(&ref);
+    const uint8_t check[] = "123456789";
+    uint16_t crc = 0xFFFF;
+    for(int i = 0; i < 9; i++)
+        crc = link_crc(crc, check[i]);
+    failures += crc != 0x29B1;
+
+    // one batch over four sections, one draw
+    s.Draw();
+    sim.ResetStats();
+    char title[] = "Batched", log1[] = "first", log2[] = "second";
+    const uint8_t bar[] = { 2, 0xFF, SHAPE_BAR, 4, 2, 117, 17, 100 };
+    const uint8_t samples[] = { 3, 10, 0, 0xF6, 0xFF, 30, 0, 20, 0 }; // 10, -10, 30, 20
+    len = link_text(records, 0, LINK_PRINT, 0, ALIGN_CENTER, title);
+    len = link_text(records, len, LINK_APPEND, 1, 0, log1);
+    len = link_text(records, len, LINK_APPEND, 1, 0, log2);
+    len = link_record(records, len, LINK_SHAPE, bar, sizeof(bar));
+    len = link_record(records, len, LINK_SAMPLES, samples, sizeof(samples));
+    len = link_record(records, len, LINK_DRAW, nullptr, 0);
+    n = link_frame(frame, ++seq, records, len);
+    failures += link_send(&l, frame, n, &reason) != LINK_ACK;
+    ref.Print(0, title, ALIGN_CENTER);
+    ref.AppendLine(1, log1);
+    ref.AppendLine(1, log2);
+    ref.AddShape(2, SHAPE_BAR, 4, 2, 117, 17, 100);
+    const int values[] = { 10, -10, 30, 20 };
+    for(int i = 0; i < 4; i++)
+        ref.AddSample(3, values[i]);
+    while(l.Poll())
+        sim.Delay(EPD_POLL_MS);
+    s.Draw();
+    diffs += screen_diff(&s, &ref);
+    failures += sim.stats.partialRefreshes != 1 || l.GetStats()->draws != 1;
+
+    // a corrupted frame is refused whole, sent again it is applied, repeated it is not applied twice
+    char log3[] = "third";
+    len = link_text(records, 0, LINK_APPEND, 1, 0, log3);
+    n = link_frame(frame, ++seq, records, len);
+    frame[6] ^= 0x20;
+    failures += link_send(&l, frame, n, &reason) != LINK_NAK || reason != LINK_ERR_CRC;
+    frame[6] ^= 0x20;
+    failures += link_send(&l, frame, n, &reason) != LINK_ACK || link_send(&l, frame, n, &reason) != LINK_ACK;
+    ref.AppendLine(1, log3);
+    diffs += screen_diff(&s, &ref);
+    failures += l.GetStats()->duplicates != 1;
+
+    // noise before a frame is skipped; a frame cut short is caught by the CRC of what follows
+    const uint8_t noise[] = { 0x00, 'x', 0xFF };
+    const uint8_t move[] = { 2, 0, SHAPE_BAR, 4, 2, 117, 17, 200 };
+    len = link_record(records, 0, LINK_SHAPE, move, sizeof(move));
+    n = link_frame(frame, ++seq, records, len);
+    failures += link_send(&l, noise, sizeof(noise), &reason) != 0 || link_send(&l, frame, n - 4, &reason) != 0
+        || link_send(&l, frame, n, &reason) != LINK_NAK || link_send(&l, frame, n, &reason) != LINK_ACK;
+    ref.SetShape(2, 0, SHAPE_BAR, 4, 2, 117, 17, 200);
+
+    // malformed frames change nothing
+    uint8_t bad[] = { LINK_SOF, ++seq, LINK_MAX_BODY + 1 };
+    failures += link_send(&l, bad, sizeof(bad), &reason) != LINK_NAK || reason != LINK_ERR_LENGTH;
+    len = link_text(records, 0, LINK_PRINT, 0, ALIGN_LEFT, log1);
+    len = link_record(records, len, 0x40, nullptr, 0);
+    n = link_frame(frame, ++seq, records, len);
+    failures += link_send(&l, frame, n, &reason) != LINK_NAK || reason != LINK_ERR_RECORD;
+    len = link_text(records, 0, LINK_PRINT, 0, ALIGN_LEFT, log1);
+    n = link_frame(frame, ++seq, records, len - 1);
+    failures += link_send(&l, frame, n, &reason) != LINK_NAK || reason != LINK_ERR_RECORD;
+    n = link_frame(frame, ++seq, records, 1);
+    failures += link_send(&l, frame, n, &reason) != LINK_NAK || reason != LINK_ERR_RECORD;
+    diffs += screen_diff(&s, &ref);
+
+    // records the screen refuses are reported, the rest of the frame still applies
+    const uint8_t level[] = { 3, 50, 0 };
+    len = link_text(records, 0, LINK_PRINT, 3, ALIGN_LEFT, title);
+    len = link_text(records, len, LINK_PRINT, 9, ALIGN_LEFT, title);
+    len = link_record(records, len, LINK_SAMPLES, level, sizeof(level));
+    n = link_frame(frame, ++seq, records, len);
+    failures += link_send(&l, frame, n, &reason) != LINK_NAK || reason != LINK_ERR_REFUSED;
+    ref.AddSample(3, 50);
+    diffs += screen_diff(&s, &ref);
+
+    // a restarted sender opens with a sync, so its first frame is applied even when it reuses the last seq
+    char log4[] = "restarted";
+    len = link_record(records, 0, LINK_SYNC, nullptr, 0);
+    n = link_frame(frame, seq - 1, records, len);
+    failures += link_send(&l, frame, n, &reason) != LINK_ACK || link_send(&l, frame, n, &reason) != LINK_ACK;
+    len = link_text(records, 0, LINK_APPEND, 1, 0, log4);
+    n = link_frame(frame, seq, records, len);
+    failures += link_send(&l, frame, n, &reason) != LINK_ACK;
+    ref.AppendLine(1, log4);
+    diffs += screen_diff(&s, &ref);
+    failures += l.GetStats()->syncs != 2 || l.GetStats()->duplicates != 1;
+
+    // a picture: refused while the panel refreshes, then sent a frame of rows at a time
+    static uint8_t pbm[8192];
+    int bytes = image_pbm(pbm, 140, "P4 122 140\n");
+    const uint8_t open[] = { 4, IMAGE_PBM };
+    len = link_record(records, 0, LINK_IMAGE, open, sizeof(open));
+    n = link_frame(frame, ++seq, records, len);
+    s.AppendLine(1, log1);
+    ref.AppendLine(1, log1);
+    s.DrawAsync();
+    failures += link_send(&l, frame, n, &reason) != LINK_NAK || reason != LINK_ERR_BUSY;
+    int busy = 0;
+    while(link_send(&l, frame, n, &reason) != LINK_ACK) {
+        busy++;
+        sim.Delay(10);
+    }
+    for(int at = 0; at < bytes; at += LINK_MAX_BODY - 6) { // room for IMAGE_END and DRAW after the last rows
+        int chunk = bytes - at < LINK_MAX_BODY - 6 ? bytes - at : LINK_MAX_BODY - 6;
+        len = link_record(records, 0, LINK_PIXELS, pbm + at, chunk);
+        if(at + chunk == bytes) {
+            len = link_record(records, len, LINK_IMAGE_END, nullptr, 0);
+            len = link_record(records, len, LINK_DRAW, nullptr, 0);
+        }
+        n = link_frame(frame, ++seq, records, len);
+        failures += link_send(&l, frame, n, &reason) != LINK_ACK;
+    }
+    while(l.Poll())
+        sim.Delay(EPD_POLL_MS);
+    s.Draw();
+    int picture = image_mismatches(&sim, 2 * Font12.Height + 3 * Font8.Height + 20 + 30, 140, 0);
+    diffs += screen_diff(&s, &ref);
+    printf("link: %d failures, %d mismatched rows, %d mismatched pixels in the picture (refused busy %d times)\n",
+        failures, diffs, picture, busy + 1);
+}
+
+/* the ;-terminated text commands examples/example1.ino read before ScreenLink: every message goes on every section */
+struct TextLink {
+    char build[64];
+    int len;
+    bool drawPending;
+};
+
+size_t text_receive(TextLink *t, Screen *s, int sections, uint8_t c, uint8_t *reply) {
+    if(c != ';' && c != '\n') {
+        if(t->len < 63)
+            t->build[t->len++] = c;
+        return 0;
+    }
+    t->build[t->len] = '\0';
+    t->len = 0;
+    for(int i = 0; i < sections; i++)
+        s->Print(i, t->build, ALIGN_CENTER);
+    t->drawPending = true;
+    memcpy(reply, "Message Received \r\n", 19);
+    return 19;
+}
+
+/* let us of device time pass on the sim's clock, keeping the part of a ms left over */
+void link_wait(EpdSim *sim, unsigned long *carry, double us) {
+    *carry += (unsigned long)us;
+    sim->Delay(*carry / 1000);
+    *carry %= 1000;
+}
+
+/*
+The sketch's side of a serial link: a message's bytes arrive one every byteUs into a LINK_RX byte
+receive buffer, which like the Arduino core's holds one byte less. Each loop() reads what has
+arrived, answering as it goes, and then polls the screen. The host sends the next message as soon
+as the answer is back, so while a draw streams rows its bytes wait in the buffer and the ones
+arriving to a full buffer are lost. now is device time in us, also kept on the sim's clock, and
+sendAt when the host can send again.
+*/
+#define LINK_RX 64
+struct LinkBoard {
+    EpdSim *sim;
+    Screen *s;
+    ScreenLink *l;  // binary frames, or the text protocol when nullptr
+    TextLink *t;
+    int sections;
+    double byteUs, now, sendAt;
+    unsigned long carry, micros;
+    long lost;
+};
+
+/* send one message once the previous answer is back, returns the bytes of the answer */
+size_t link_deliver(LinkBoard *b, const uint8_t *msg, int n) {
+    uint8_t reply[32];
+    size_t answer = 0;
+    double start = b->sendAt;
+    int read = 0;
+    while(read < n) {
+        int ready = (int)((b->now - start) / b->byteUs + 1e-6);
+        ready = ready < read ? read : ready < n ? ready : n;
+        int kept = ready - read < LINK_RX - 1 ? ready - read : LINK_RX - 1;
+        b->lost += ready - read - kept;
+        for(int i = read; i < read + kept; i++) {
+            size_t got = b->l ? b->l->Receive(msg[i], reply) : text_receive(b->t, b->s, b->sections, msg[i], reply);
+            if(got > 0)
+                b->sendAt = b->now + got * b->byteUs; // the answer on its way back
+            answer += got;
+        }
+        read = ready;
+        if(b->l)
+            b->l->Poll();
+        else if(b->t->drawPending && b->s->DrawAsync() == 0)
+            b->t->drawPending = false;
+        unsigned long bus = b->sim->transfer.micros - b->micros; // the bus time the loop took
+        b->now += bus;
+        b->micros += bus;
+        double next = start + (read + 1) * b->byteUs;
+        if(bus == 0 && read < n && next > b->now) { // nothing to do until the next byte
+            link_wait(b->sim, &b->carry, next - b->now);
+            b->now = next;
+        }
+    }
+    return answer;
+}
+
+/*
+Dashboard updates over a 115200 baud loopback, each sent once the previous one was answered:
+the text protocol, one binary frame per update and as many updates as fit batched in a frame.
+The wire time both ways and the panel's bus time add up on the simulator's clock.
+*/
+void link_bench() {
+    const int updates = 200, sections = 5;
+    const long baud = 115200;
+    const double byteUs = 10e6 / baud;
+    const char *kinds[] = { "text", "binary", "batched" };
+    for(int kind = 0; kind < 3; kind++) {
+        EpdSim sim;
+        Screen s(&sim), ref;
+        ScreenLink l(&s);
+        TextLink t = { { 0 }, 0, false };
+        Screen *both[] = { &s, &ref };
+        for(int b = 0; b < 2; b++) {
+            Screen *p = both[b];
+            p->ScreenInit(sections);
+            p->DefineSection(0, 2, &Font8);
+            p->DefineSection(1, 2, &Font12);
+            p->DefineSection(2, 2, &Font16);
+            p->DefineSection(3, 2, &Font20);
+            p->DefineSection(4, 2, &Font24);
+        }
+        s.Draw();
+        sim.ResetStats();
+        uint8_t records[LINK_MAX_BODY], frame[LINK_MAX_BODY + 8];
+        char txt[16];
+        LinkBoard b = { &sim, &s, kind == 0 ? nullptr : &l, &t, sections, byteUs, 0, 0, 0, sim.transfer.micros, 0 };
+        unsigned long start = sim.Millis();
+        long sent = 0, back = 0;
+        int len = 0, seq = 0, unanswered = 0;
+        for(int u = 0; u < updates; u++) {
+            snprintf(txt, sizeof(txt), "%d.%dC", 15 + u * 7 % 20, u % 10);
+            int n;
+            if(kind == 0) {
+                n = snprintf((char *)frame, sizeof(frame), "%s;", txt);
+                for(int i = 0; i < sections; i++)
+                    ref.Print(i, txt, ALIGN_CENTER);
+            } else {
+                len = link_text(records, len, LINK_PRINT, u % sections, ALIGN_CENTER, txt);
+                ref.Print(u % sections, txt, ALIGN_CENTER);
+                // room left for another reading of up to 5 characters and the draw
+                if(kind == 2 && len + 2 + 2 + 5 + 2 <= LINK_MAX_BODY && u != updates - 1)
+                    continue;
+                len = link_record(records, len, LINK_DRAW, nullptr, 0);
+                n = link_frame(frame, ++seq, records, len);
+                len = 0;
+            }
+            size_t answer = link_deliver(&b, frame, n);
+            unanswered += answer == 0;
+            sent += n;
+            back += answer;
+        }
+        unsigned long acked = sim.Millis() - start;
+        while(l.Poll() || (t.drawPending && s.DrawAsync() != 0) || !s.Poll())
+            sim.Delay(EPD_POLL_MS);
+        unsigned long shown = sim.Millis() - start;
+        printf("link: %-7s %d updates, %.1f bytes sent and %.1f back per update, %.0f updates/s (%lu ms, %lu ms until shown), %d refreshes, %ld bytes lost, %d unanswered, %d mismatched rows\n",
+            kinds[kind], updates, (double)sent / updates, (double)back / updates, updates * 1000.0 / acked, acked, shown,
+            sim.stats.partialRefreshes, b.lost, unanswered, screen_diff(&s, &ref));
+    }
+
+    // parsing cost alone, without the panel
+    const int frames = 200000;
+    for(int kind = 0; kind < 2; kind++) {
+        Screen s;
+        ScreenLink l(&s);
+        TextLink t = { { 0 }, 0, false };
+        s.ScreenInit(1);
+        s.DefineSection(0, 2, &Font12);
+        static uint8_t frames256[256][LINK_MAX_BODY + 8];
+        uint8_t records[LINK_MAX_BODY], reply[32];
+        char txt[] = "21.5C";
+        int n = 0;
+        for(int f = 0; f < 256; f++) // a new seq each time, the same frame again would be a duplicate
+            n = kind == 0 ? snprintf((char *)frames256[f], sizeof(frames256[f]), "%s;", txt)
+                : link_frame(frames256[f], f, records, link_text(records, 0, LINK_PRINT, 0, ALIGN_CENTER, txt));
+        clock_t c = clock();
+        for(int f = 0; f < frames; f++) {
+            const uint8_t *frame = frames256[f & 0xFF];
+            for(int i = 0; i < n; i++)
+                kind == 0 ? text_receive(&t, &s, 1, frame[i], reply) : l.Receive(frame[i], reply);
+        }
+        double secs = (double)(clock() - c) / CLOCKS_PER_SEC;
+        printf("link: %-7s %.0f messages/s parsed and printed on the host\n", kinds[kind], frames / secs);
+    }
+}
+
+/* the REFRESH_ kind the last draw used, from the counters before it */
+int refresh_kind(const RefreshState *before, Screen *s) {
+    const RefreshState *after = s->GetRefreshState();
+    if(after->full != before->full)
+        return REFRESH_FULL;
+    if(after->fast != before->fast)
+        return REFRESH_FAST;
+    return after->partial != before->partial ? REFRESH_PARTIAL : -1;
+}
+
+/* RefreshPolicy clearing ghosting every *arg draws, whatever they changed */
+uint8_t refresh_every(const RefreshState *state, const void *arg) {
+    int n = *(const int *)arg;
+    return (state->partial + state->fast + state->full + 1) % n == 0 ? REFRESH_FAST : REFRESH_PARTIAL;
+}
+
+/* draw s once, returning the kind used; counts LUTs of the wrong length and pixels the panel shows wrong */
+int refresh_draw(EpdSim *sim, Screen *s, int *wrongFrames, int *pixels) {
+    static const int frames[] = { 10, 30, 90 };
+    RefreshState before = *s->GetRefreshState();
+    s->Draw();
+    int kind = refresh_kind(&before, s);
+    if(kind >= 0 && sim->stats.lastFrames != frames[kind])
+        (*wrongFrames)++;
+    *pixels += sim_mismatches(sim, s);
+    return kind;
+}
+
+/* partial refreshes until a region has had 40, then a fast refresh, every fifth clear a full one */
+void refresh_test() {
+    EpdSim sim;
+    Screen s(&sim);
+    char txt[16];
+    const char *names[] = { "partial", "fast", "full" };
+    s.ScreenInit(4);
+    s.DefineSection(0, 1, &Font24); // rows 0..23, region 0
+    s.DefineSection(1, 1, &Font8);  // 24..31, left alone
+    s.DefineSection(2, 1, &Font24); // 32..55, regions 1 and 2
+    s.DefineSection(3, 8, &Font24); // 56..247
+    int wrongFrames = 0, pixels = 0, wrong = 0;
+    snprintf(txt, sizeof(txt), "start");
+    s.Print(0, txt);
+    s.Draw();
+    sim.ResetStats();
+
+    // a clock in one corner: the model counts partial refreshes of region 0
+    const int draws = 400;
+    int kinds[3] = { 0, 0, 0 }, partials = 0, fasts = 0;
+    unsigned long start = sim.Millis();
+    for(int i = 0; i < draws; i++) {
+        snprintf(txt, sizeof(txt), "%02d:%02d", i / 60, i % 60);
+        s.Print(0, txt);
+        int expect = REFRESH_PARTIAL;
+        if(partials >= refresh_defaults.partials)
+            expect = fasts >= refresh_defaults.fasts ? REFRESH_FULL : REFRESH_FAST;
+        int kind = refresh_draw(&sim, &s, &wrongFrames, &pixels);
+        wrong += kind != expect;
+        if(kind >= 0)
+            kinds[kind]++;
+        partials = expect == REFRESH_PARTIAL ? partials + 1 : 0;
+        fasts = expect == REFRESH_FAST ? fasts + 1 : expect == REFRESH_FULL ? 0 : fasts;
+    }
+    unsigned long elapsed = sim.Millis() - start;
+    printf("refresh: %d draws, %d/%d/%d %s/%s/%s (%d unlike the model), ghosts at most %d, %d+%d sim refreshes, %d wrong LUT lengths, %d mismatched pixels\n",
+        draws, kinds[0], kinds[1], kinds[2], names[0], names[1], names[2], wrong, sim.stats.ghostMax,
+        sim.stats.fullRefreshes, sim.stats.partialRefreshes, wrongFrames, pixels);
+    printf("refresh: %lu ms busy in %lu ms, %d ms a draw against %d ms with a full refresh each time\n",
+        sim.stats.refreshMs, elapsed, (int)(sim.stats.refreshMs / draws), SIM_FRAME_MS * 90);
+
+    // other regions keep their own count
+    const RefreshState *state = s.GetRefreshState();
+    int corner = state->regions[0], local = 0;
+    for(int i = 0; i < refresh_defaults.partials - 1; i++) {
+        snprintf(txt, sizeof(txt), "%d", i);
+        s.Print(2, txt);
+        local += refresh_draw(&sim, &s, &wrongFrames, &pixels) == REFRESH_PARTIAL;
+    }
+    printf("refresh: %d of %d partial elsewhere, region 0 kept %d (was %d), regions 1..2 at %d %d\n",
+        local, refresh_defaults.partials - 1, state->regions[0], corner, state->regions[1], state->regions[2]);
+
+    // an hour without a clear
+    sim.Delay(refresh_defaults.clearMs);
+    s.Print(0, txt);
+    int hour = refresh_draw(&sim, &s, &wrongFrames, &pixels);
+
+    // a change over half the panel clears at once, every third clear full
+    RefreshLimits limits = { 0, 500, 0, 2 };
+    s.SetRefreshPolicy(refresh_limits, &limits);
+    int area[4];
+    for(int i = 0; i < 4; i++) {
+        snprintf(txt, sizeof(txt), "%d", i);
+        s.Print(0, txt);
+        snprintf(txt, sizeof(txt), "\n\n\n\n\n\n\n%d", i); // the bottom line, rows 0..247 change with the corner
+        if(i > 0)
+            s.Print(3, txt);
+        area[i] = refresh_draw(&sim, &s, &wrongFrames, &pixels);
+    }
+    printf("refresh: after an hour %s, area rule %s %s %s %s\n",
+        names[hour], names[area[0]], names[area[1]], names[area[2]], names[area[3]]);
+
+    // a policy of one's own, then none at all
+    int every = 5, custom = 0;
+    s.SetRefreshPolicy(refresh_every, &every);
+    for(int i = 0; i < 20; i++) {
+        snprintf(txt, sizeof(txt), "%d", i);
+        s.Print(0, txt);
+        custom += refresh_draw(&sim, &s, &wrongFrames, &pixels) == REFRESH_FAST;
+    }
+    s.SetRefreshPolicy(refresh_partial_only);
+    sim.ResetStats();
+    for(int i = 0; i < 100; i++) {
+        snprintf(txt, sizeof(txt), "%d", i);
+        s.Print(0, txt);
+        refresh_draw(&sim, &s, &wrongFrames, &pixels);
+    }
+    printf("refresh: every %d draws %d fast of 20, partial only %d+%d sim refreshes with ghosts up to %d, %d wrong LUT lengths, %d mismatched pixels\n",
+        every, custom, sim.stats.fullRefreshes, sim.stats.partialRefreshes, sim.stats.ghostMax, wrongFrames, pixels);
+}
+
 int main(int argc, char* argv[]) {
 
     Screen s = Screen();
@@ -518,6 +4568,32 @@ int main(int argc, char* argv[]) {
         s.AddText(0, argv[0]);
     }
     s.Print();
+    partial_test();
+    sim_test();
+    async_test();
+    wake_test();
+    cache_bench();
+    transfer_bench();
+    blit_test();
+    render_bench(&s);
+    panel_byte_bench(&s);
+    layout_bench();
+    arena_test();
+    print_bench();
+    row_bench();
+    log_bench();
+    wrap_test();
+    prop_test();
+    utf8_test();
+    packed_bench();
+    scale_test();
+    rotate_test();
+    graphics_test();
+    chart_test();
+    image_test();
+    link_test();
+    link_bench();
+    refresh_test();
     // printf("%d\n", EPD_WIDTH / 7);
     // partialwrite_test();
     // betterbitmap_test();
@@ -5,6 +5,10 @@
 #define EPD_WIDTH 122
 #define EPD_HEIGHT 250
 
+// busy line: how long an operation may take to raise it, and how often it is polled
+#define EPD_BUSY_RISE_MS 10
+#define EPD_POLL_MS 1
+
 #define RST_PIN 8
 #define DC_PIN 9
 #define CS_PIN 10
@@ -13,10 +17,44 @@
 // Screen Defines
 #define LINEBYTES 16
 #define LINEBITS (LINEBYTES * 8)
+#define LINEPAD (LINEBITS - EPD_WIDTH) // leading bits of a line that fall off the panel
+#define GLYPHBYTES ((MAX_WIDTH_FONT + 7) / 8) // widest glyph row
 
 #define ALIGN_LEFT 0
 #define ALIGN_CENTER 1
 #define ALIGN_RIGHT 2
+#define PRINT_WRAP 0x10 // OR with an ALIGN_ mode to break Print lines between words
+
+// SetRotation: sections are laid out on a canvas turned this far clockwise on the panel
+#define ROTATE_0 0
+#define ROTATE_90 1   // 250x122 landscape, canvas top along the right edge of the panel
+#define ROTATE_180 2
+#define ROTATE_270 3  // 250x122 landscape, canvas top along the left edge of the panel
+#define CANVASBYTES ((EPD_HEIGHT + LINEPAD + 7) / 8) // widest canvas row ComposeNext writes, landscape
+
+// AddShape kinds, see DefineGraphics
+#define SHAPE_HLINE 0
+#define SHAPE_VLINE 1
+#define SHAPE_LINE 2  // Bresenham line between the two points
+#define SHAPE_RECT 3  // outline
+#define SHAPE_FILL 4  // solid rectangle
+#define SHAPE_BAR 5   // progress gauge: outline, inside filled value/255 of the way from the left
+
+// DefineChart styles
+#define CHART_LINE 0
+#define CHART_BARS 1
+
+// refresh kinds a RefreshPolicy chooses between, see SetRefreshPolicy
+#define REFRESH_PARTIAL 0 // only the pixels that changed, quick but leaves ghosts behind
+#define REFRESH_FAST 1    // every pixel through a short black/white cycle, clears most ghosting
+#define REFRESH_FULL 2    // the complete waveform, clears all ghosting
+#define REFRESH_NONE 0xFF // no LUT loaded since the last reset
+#define REFRESH_BAND 25   // panel rows per region partial refreshes are counted in
+#define REFRESH_REGIONS ((EPD_HEIGHT + REFRESH_BAND - 1) / REFRESH_BAND)
+
+// BeginImage formats: rows of 1bpp pixels, 1 = black, leftmost pixel in the MSB, each row padded to whole bytes
+#define IMAGE_RAW 0
+#define IMAGE_PBM 1   // the same rows after a binary PBM (P4) header, which must give a width of EPD_WIDTH
 
 
 // #define UNIT 0
@@ -26,64 +64,246 @@
 #else
 #include "Arduino.h"
 #include <SPI.h>
-#include <avr/pgmspace.h>
 #endif
 #include "fonts.h"
+#include "epd_transport.h"
 #include <stdlib.h>
+#include <string.h>
+
+// Section storage: one cell per character position holding glyph index + 1.
+// Define SCREEN_WIDE_CELLS for fonts of more than 255 glyphs, at twice the RAM per cell
+#ifdef SCREEN_WIDE_CELLS
+typedef uint16_t cell_t;
+#else
+typedef uint8_t cell_t;
+#endif
+#define CELL_EMPTY 0
+#define CELL_MAX ((cell_t)~(cell_t)0)
 
-const unsigned char lut_full_update[]= {
-    0x80,0x60,0x40,0x00,0x00,0x00,0x00,             //LUT0: BB:     VS 0 ~7
-    0x10,0x60,0x20,0x00,0x00,0x00,0x00,             //LUT1: BW:     VS 0 ~7
-    0x80,0x60,0x40,0x00,0x00,0x00,0x00,             //LUT2: WB:     VS 0 ~7
-    0x10,0x60,0x20,0x00,0x00,0x00,0x00,             //LUT3: WW:     VS 0 ~7
-    0x00,0x00,0x00,0x00,0x00,0x00,0x00,             //LUT4: VCOM:   VS 0 ~7
-
-    0x03,0x03,0x00,0x00,0x02,                       // TP0 A~D RP0
-    0x09,0x09,0x00,0x00,0x02,                       // TP1 A~D RP1
-    0x03,0x03,0x00,0x00,0x02,                       // TP2 A~D RP2
-    0x00,0x00,0x00,0x00,0x00,                       // TP3 A~D RP3
-    0x00,0x00,0x00,0x00,0x00,                       // TP4 A~D RP4
-    0x00,0x00,0x00,0x00,0x00,                       // TP5 A~D RP5
-    0x00,0x00,0x00,0x00,0x00,                       // TP6 A~D RP6
-
-    0x15,0x41,0xA8,0x32,0x30,0x0A,
+/* characters in the UTF-8 text s, decoded the way Print and AddText read it */
+int utf8_count(const char *s);
+
+// waveform LUTs: 70 bytes for register 0x32, then the gate and source voltages, dummy line and gate time
+extern const unsigned char lut_full_update[] PROGMEM;
+extern const unsigned char lut_partial_update[] PROGMEM;
+extern const unsigned char lut_fast_update[] PROGMEM;
+
+#if defined(__AVR__)
+typedef uint32_t blit_acc_t;
+#define BLIT_CHUNK 8
+#else
+typedef uint64_t blit_acc_t;
+#define BLIT_CHUNK 32
+#endif
+
+/* MSB-first bit writer composing a scanline a glyph row at a time */
+struct Blitter {
+    unsigned char *dst;
+    blit_acc_t acc; // pending bits, right aligned
+    uint8_t bits;   // number of pending bits
 };
 
 struct Section {
-    sFONT *font;
+    sFONT *font;    // one row high placeholder for graphics, chart and image sections
     int cap;
-    int width;
+    int width;      // cells per line, shapes a graphics section holds or samples a chart holds
     int height;
+    int dirtyFirst; // first changed line since the last Draw, -1 when clean
+    int dirtyLast;
+    int head;       // stored line shown at the top, lines are a ring once AppendLine scrolls; oldest chart sample
+    int fill;       // lines AppendLine has filled, height once the section scrolls; shapes or samples held
+    uint8_t scale;  // glyphs drawn at 1x, 2x or 3x by pixel replication
+};
+
+/* display list entry of a graphics section; x in canvas pixels, y in section rows */
+struct Shape {
+    uint8_t kind;
+    uint8_t x0, y0, x1, y1;
+    uint8_t value; // SHAPE_BAR fill, 0..255
+};
+
+/* head of a chart section's storage, followed by the sample ring and the row each sample plots at */
+struct ChartHeader {
+    int16_t lo;    // range of the samples held, the chart's vertical scale
+    int16_t hi;
+    uint8_t style;
+    uint8_t pad;
+};
+
+/* an image on its way into panel RAM, see BeginImage */
+struct ImageStream {
+    int section;   // -1 when no image is open
+    int rows;      // rows the image has, the section height unless a PBM header says otherwise
+    int row;       // rows received
+    uint16_t number; // PBM header field being read
+    uint8_t state;   // PBM header parse state, IMAGE_BODY once the pixels start
+    uint8_t at;      // bytes of the current row held
+    uint8_t line[LINEBYTES];
+};
+
+/* refresh counters, and the draw being decided when a RefreshPolicy is asked */
+struct RefreshState {
+    unsigned long partial;  // refreshes of each kind so far
+    unsigned long fast;
+    unsigned long full;
+    uint8_t regions[REFRESH_REGIONS]; // partial refreshes each band of rows has had since the panel was last driven whole
+    uint8_t fastsSinceFull;
+    unsigned long lastClear; // Millis() of the last fast or full refresh
+    int first;              // panel rows the draw rewrites
+    int last;
+    uint8_t worst;          // most partial refreshes of a region among those rows
+    uint16_t area;          // per mille of the panel the draw rewrites
+    unsigned long now;
+};
+
+/* picks REFRESH_PARTIAL, REFRESH_FAST or REFRESH_FULL for a draw; arg is what SetRefreshPolicy was given */
+typedef uint8_t (*RefreshPolicy)(const RefreshState *state, const void *arg);
+
+/* thresholds for refresh_limits, 0 turns a rule off */
+struct RefreshLimits {
+    uint8_t partials;      // a region's partial refreshes that call for a fast one
+    uint16_t area;         // per mille of the panel changed at once that calls for a fast refresh
+    unsigned long clearMs; // longest time between fast or full refreshes, checked when drawing
+    uint8_t fasts;         // fast refreshes before the next one is full, 0 = always full
+};
+
+extern const RefreshLimits refresh_defaults;
+uint8_t refresh_limits(const RefreshState *state, const void *arg);
+uint8_t refresh_partial_only(const RefreshState *state, const void *arg);
+
+#define LAYOUT_BLANK 0xFF // LayoutRow section for rows below the last section
+
+/* where a panel row comes from */
+struct LayoutRow {
+    uint8_t section;
+    uint8_t line;   // glyph line within the section
+    uint8_t subrow; // row within the glyph
+};
+
+/* position of a canvas row (the panel row unless rotated) within the sections, advanced row by row without dividing */
+struct RowCursor {
+    int section; // == sections past the last one, rows there are blank
+    int line;    // glyph line within the section
+    uint8_t subrow;
+};
+
+/* section state resolved ahead of time, see layout.h */
+struct ScreenLayout {
+    int sections;
+    struct Section **descs;
+    cell_t **cells;
+    const LayoutRow *rows; // PROGMEM, EPD_HEIGHT entries
 };
 
 class Screen {
     public:
         Screen();
+        Screen(EpdTransport *transport);
         ~Screen();
         void ScreenInit(int sectors);
+        void ScreenInit(const ScreenLayout *layout);
+        int ScreenInit(int sectors, uint8_t *arena, size_t bytes);
+        static size_t ArenaBytes(int sectors, const int *lines, sFONT *const *fonts, const uint8_t *scales=nullptr, int rotation=ROTATE_0, const int *samples=nullptr);
         unsigned char *GetLine(int x);
-        int DefineSection(int section, int lines, sFONT *font);
-        void AddText(int section, char *txt);
-        void Print(int section, char *txt, int align=ALIGN_LEFT);
+        void RenderLine(int x, unsigned char *line);
+        void ComposeLine(int x, unsigned char *line);
+        void SeekRow(int x, RowCursor *at);
+        int ComposeNext(RowCursor *at, unsigned char *line, size_t len=LINEBYTES);
+        int DefineSection(int section, int lines, sFONT *font, uint8_t scale=1);
+        int DefineGraphics(int section, int rows, int shapes);
+        int AddShape(int section, uint8_t kind, int x0, int y0, int x1, int y1, uint8_t value=0);
+        int SetShape(int section, int shape, uint8_t kind, int x0, int y0, int x1, int y1, uint8_t value=0);
+        void ClearShapes(int section);
+        int DefineChart(int section, int rows, int samples, uint8_t style=CHART_LINE);
+        int AddSample(int section, int value);
+        int GetChartRange(int section, int *lo, int *hi);
+        void ClearSamples(int section);
+        int DefineImage(int section, int rows);
+        int BeginImage(int section, uint8_t format=IMAGE_RAW);
+        int PushImage(const uint8_t *data, size_t len);
+        int EndImage();
+        int AddText(int section, char *txt);
+        int Print(int section, char *txt, int align=ALIGN_LEFT);
         void Print();
+        int AppendLine(int section, const char *txt);
+        void SetFallback(uint32_t code);
+        int SetRotation(int rotation);
         // Epd
         void Reset();
         void Clear();
         void Sleep();
         void Draw();
+        int DrawAsync();
+        bool Poll();
+        bool GetDirtyRows(int *first, int *last);
+        const EpdTransferStats *GetTransferStats();
+        size_t SectionBytes(int section);
+        void SetRefreshPolicy(RefreshPolicy policy, const void *arg=nullptr);
+        const RefreshState *GetRefreshState();
 
     private:
-        const uint8_t ***secPtrs;
-        struct Section **secDescs;
-        int sects;
+        cell_t **secCells = nullptr;
+        struct Section **secDescs = nullptr;
+        int sects = 0;
+        const LayoutRow *rowMap = nullptr; // set when the sections come from a compile-time layout
+        uint8_t *arena = nullptr; // caller-owned section storage, see ScreenInit(int, uint8_t *, size_t)
+        size_t arenaSize = 0;
+        size_t arenaUsed = 0;
+        EpdTransport *epd;
         bool epdInit = false;
-        unsigned char *GetLineFromSection(int section, int x);
+        bool fullPending = true; // panel RAM does not hold a base image, next Draw is a full refresh
+        uint8_t lut = REFRESH_FULL; // waveform loaded in the panel
+        RefreshPolicy policy = refresh_limits;
+        const void *policyArg = nullptr;
+        RefreshState refresh = { 0, 0, 0, { 0 }, 0, 0, 0, 0, 0, 0, 0 };
+        bool lutPending = false;  // load the partial LUT once the running full refresh ends
+        bool busyPending = false; // an operation was started and has not been seen to finish
+        bool busySeen = false;
+        unsigned long busyStart = 0;
+        uint32_t fallback = '?'; // drawn for code points a font has no glyph for
+        uint8_t rotation = ROTATE_0;
+        int canvasWidth = EPD_WIDTH; // pixels across a section line, EPD_HEIGHT in landscape
+        int canvasHeight = EPD_HEIGHT;
+        uint8_t canvasBytes = LINEBYTES; // bytes of a composed canvas row, LINEPAD blank bits first
+        ImageStream stream = { -1, 0, 0, 0, 0, 0, { 0 } };
+        int imageFirst = EPD_HEIGHT; // panel rows images went to since the last draw
+        int imageLast = -1;
+        void ComposeLineFromSection(int section, int x, unsigned char *line);
+        void ComposeGlyphLine(int section, int ln, uint8_t subln, unsigned char *line);
+        void ComposeShapeLine(int section, int y, unsigned char *line);
+        uint8_t ShapeByte(int section, int y, int x0);
+        void ComposeChartLine(int section, int y, unsigned char *line);
+        uint8_t ChartByte(int section, int y, int x0);
+        void ChartRemap(int section);
+        int ImageHeader(uint8_t c);
+        void SendImageRow();
+        bool IsGraphics(int section);
+        int AllocSection(int section, size_t bytes);
+        struct Section *NewSection(int section, sFONT *font, int lines, int lineRows, int width, size_t bytes);
+        void StoreShape(int section, Shape *sh, uint8_t kind, int x0, int y0, int x1, int y1, uint8_t value);
+        void ComposeCanvasLine(int y, unsigned char *line);
+        uint8_t GlyphByte(int section, int ln, uint8_t subln, int x0);
+        void ComposeBand(int first, unsigned char band[8][LINEBYTES]);
+        void StepRow(RowCursor *at);
+        void MarkDirty(int section, int first, int last);
+        void ResetRing(int section);
+        void ClearDirty();
         // Epd
         int EpdInit();
-        void SpiTransfer(unsigned char data);
         void SendCommand(unsigned char command);
         void SendData(unsigned char data);
+        void SendDataBlock(const uint8_t *data, size_t len);
         void WaitUntilIdle();
+        void BusyStart();
+        void Activate(unsigned char mode);
+        void StartDraw();
+        void Begin();
+        void SetLut(uint8_t kind);
+        uint8_t ChooseRefresh(int first, int last);
+        void Refreshed(uint8_t kind, int first, int last);
+        void SetWindow(int first, int last);
+        void SendRows(int first, int last);
+        void SendSpan(int first, int last, unsigned char command);
         void TearDown();
 };
 #endif
@@ -0,0 +1,178 @@
+#include "screen_link.h"
+
+// Receive states, in the order the frame arrives
+#define LINK_WAIT 0
+#define LINK_SEQ 1
+#define LINK_LENGTH 2
+#define LINK_BODY 3
+#define LINK_CRC_LO 4
+#define LINK_CRC_HI 5
+
+/* CRC-16/CCITT-FALSE, start from 0xFFFF */
+uint16_t link_crc(uint16_t crc, uint8_t byte) {
+    crc ^= (uint16_t)byte << 8;
+    for(int i = 0; i < 8; i++)
+        crc = crc & 0x8000 ? (crc << 1) ^ 0x1021 : crc << 1;
+    return crc;
+}
+
+ScreenLink::ScreenLink(Screen *screen) : screen(screen) { }
+
+/*
+Take the next byte from the sender. Once a frame is complete it is checked and applied
+and the answer is written to reply; returns its length (0 until then, at most LINK_REPLY_BYTES).
+Bytes between frames are skipped up to the next LINK_SOF.
+*/
+size_t ScreenLink::Receive(uint8_t byte, uint8_t *reply) {
+    switch(state) {
+        case LINK_WAIT:
+            if(byte == LINK_SOF) {
+                crc = 0xFFFF;
+                state = LINK_SEQ;
+            }
+            return 0;
+        case LINK_SEQ:
+            seq = byte;
+            crc = link_crc(crc, byte);
+            state = LINK_LENGTH;
+            return 0;
+        case LINK_LENGTH:
+            if(byte > LINK_MAX_BODY) {
+                state = LINK_WAIT;
+                stats.naks++;
+                reply[0] = LINK_NAK;
+                reply[1] = seq;
+                reply[2] = LINK_ERR_LENGTH;
+                return 3;
+            }
+            length = byte;
+            at = 0;
+            crc = link_crc(crc, byte);
+            state = length > 0 ? LINK_BODY : LINK_CRC_LO;
+            return 0;
+        case LINK_BODY:
+            body[at++] = byte;
+            crc = link_crc(crc, byte);
+            if(at == length)
+                state = LINK_CRC_LO;
+            return 0;
+        case LINK_CRC_LO:
+            crc ^= byte;
+            state = LINK_CRC_HI;
+            return 0;
+    }
+    // LINK_CRC_HI: the frame is complete
+    state = LINK_WAIT;
+    stats.frames++;
+    crc ^= (uint16_t)byte << 8;
+    int err = crc != 0 ? LINK_ERR_CRC : 0;
+    if(err == 0 && length == 2 && body[0] == LINK_SYNC && body[1] == 0) {
+        stats.syncs++; // a new sender, checked before repeats since its seq may be the old last one
+        lastSeq = seq;
+    } else if(err == 0 && seq == lastSeq) {
+        stats.duplicates++; // our ACK was lost, the frame is already applied
+    } else if(err == 0 && (err = Check()) == 0) {
+        for(int i = 0; i < length; i += 2 + body[i + 1]) {
+            if(Apply(body[i], body + i + 2, body[i + 1]))
+                err = LINK_ERR_REFUSED;
+        }
+        lastSeq = seq;
+    }
+    reply[1] = seq;
+    if(err == 0) {
+        reply[0] = LINK_ACK;
+        return 2;
+    }
+    stats.naks++;
+    reply[0] = LINK_NAK;
+    reply[2] = err;
+    return 3;
+}
+
+/* make sure the records fill the frame exactly and have the arguments they need, before any is applied */
+int ScreenLink::Check() {
+    bool image = false;
+    for(int i = 0; i < length; ) {
+        if(i + 2 > length || i + 2 + body[i + 1] > length)
+            return LINK_ERR_RECORD;
+        uint8_t op = body[i], n = body[i + 1];
+        bool ok;
+        switch(op) {
+            case LINK_PRINT: ok = n >= 2; break;
+            case LINK_APPEND: ok = n >= 1; break;
+            case LINK_SHAPE: ok = n == 8; break;
+            case LINK_SAMPLES: ok = n % 2 == 1; break;
+            case LINK_IMAGE: ok = n == 2; break;
+            case LINK_PIXELS: ok = true; break;
+            case LINK_IMAGE_END: case LINK_DRAW: case LINK_CLEAR: case LINK_SLEEP: case LINK_WAKE:
+                ok = n == 0;
+                break;
+            default: ok = false;
+        }
+        if(!ok)
+            return LINK_ERR_RECORD;
+        image |= op == LINK_IMAGE;
+        i += 2 + n;
+    }
+    if(image && !screen->Poll())
+        return LINK_ERR_BUSY;
+    return 0;
+}
+
+/* apply one record, returns 1 when the screen refused it */
+int ScreenLink::Apply(uint8_t op, uint8_t *args, uint8_t n) {
+    stats.records++;
+    int refused = 0;
+    if(op == LINK_PRINT || op == LINK_APPEND) {
+        // terminate the text in place, putting back the first byte of the next record afterwards
+        uint8_t skip = op == LINK_PRINT ? 2 : 1, next = args[n];
+        args[n] = '\0';
+        char *txt = (char *)args + skip;
+        if(op == LINK_APPEND)
+            refused = screen->AppendLine(args[0], txt);
+        else {
+            int len = utf8_count(txt);
+            refused = screen->Print(args[0], txt, args[1]) == len && len > 0; // nothing shown
+        }
+        args[n] = next;
+    } else if(op == LINK_SHAPE) {
+        if(args[1] == 0xFF)
+            refused = screen->AddShape(args[0], args[2], args[3], args[4], args[5], args[6], args[7]) < 0;
+        else
+            refused = screen->SetShape(args[0], args[1], args[2], args[3], args[4], args[5], args[6], args[7]);
+    } else if(op == LINK_SAMPLES) {
+        for(int i = 1; i < n; i += 2)
+            refused |= screen->AddSample(args[0], (int16_t)(args[i] | args[i + 1] << 8));
+    } else if(op == LINK_IMAGE) {
+        refused = screen->BeginImage(args[0], args[1]);
+    } else if(op == LINK_PIXELS) {
+        refused = screen->PushImage(args, n) < 0;
+    } else if(op == LINK_IMAGE_END) {
+        refused = screen->EndImage();
+    } else if(op == LINK_DRAW) {
+        drawPending = true;
+    } else if(op == LINK_CLEAR) {
+        screen->Clear();
+    } else if(op == LINK_SLEEP) {
+        screen->Sleep();
+    } else if(op == LINK_WAKE) {
+        screen->Reset();
+    }
+    return refused;
+}
+
+/*
+Call from the main loop: starts the draw LINK_DRAW asked for once the panel is free, so updates
+arriving during a refresh go out together on the next one. Returns true while a draw is waiting.
+*/
+bool ScreenLink::Poll() {
+    if(drawPending && screen->DrawAsync() == 0) {
+        drawPending = false;
+        stats.draws++;
+    }
+    return drawPending;
+}
+
+const LinkStats *ScreenLink::GetStats() {
+    return &stats;
+}
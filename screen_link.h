@@ -0,0 +1,86 @@
+#ifndef SCREEN_LINK_H
+#define SCREEN_LINK_H
+
+/*
+Binary command link driving a Screen from a byte stream such as Serial. Each frame
+carries any number of records, so several sections can change in one frame and be
+shown by a single draw:
+
+    frame:  LINK_SOF, seq, length, records (length bytes), CRC-16 low byte, high byte
+    record: opcode, n, n bytes of arguments
+
+The CRC is CRC-16/CCITT-FALSE over seq, length and the records. Every frame is answered
+with LINK_ACK, seq once it has been applied, or LINK_NAK, seq, reason. A sender waits for
+the answer before the next frame, which keeps at most one frame on the wire, and sends
+the frame again after a NAK or a timeout. A frame repeating the last applied seq is
+acknowledged without being applied again. A sender starts with a frame holding only a
+LINK_SYNC record, which is always applied and takes its seq as the last one, so the first
+frame after it is not mistaken for a repeat whatever an earlier sender left off at.
+tools/screenlink.py is the sending side.
+*/
+
+#include "screen.h"
+
+#define LINK_SOF 0x7E
+// record bytes a frame may carry: with its 5 other bytes a frame fits the 63 bytes an Arduino's
+// 64 byte serial receive buffer holds, so the next frame can wait there while a draw streams rows
+#define LINK_MAX_BODY 58
+#define LINK_ACK 0x06
+#define LINK_NAK 0x15
+#define LINK_REPLY_BYTES 3
+
+// record opcodes and their arguments
+#define LINK_PRINT 0x01     // section, align, text: Print
+#define LINK_APPEND 0x02    // section, text: AppendLine
+#define LINK_SHAPE 0x03     // section, shape (0xFF adds one), kind, x0, y0, x1, y1, value: SetShape or AddShape
+#define LINK_SAMPLES 0x04   // section, int16 values low byte first: AddSample
+#define LINK_IMAGE 0x05     // section, format: BeginImage
+#define LINK_PIXELS 0x06    // image bytes: PushImage
+#define LINK_IMAGE_END 0x07 // EndImage
+#define LINK_DRAW 0x08      // draw everything so far once the panel is free
+#define LINK_CLEAR 0x09
+#define LINK_SLEEP 0x0A
+#define LINK_WAKE 0x0B
+#define LINK_SYNC 0x0C      // alone in a frame: a new sender, the frame's seq becomes the last applied
+
+// NAK reasons
+#define LINK_ERR_CRC 1
+#define LINK_ERR_LENGTH 2  // length over LINK_MAX_BODY
+#define LINK_ERR_RECORD 3  // unknown opcode or records not filling the frame exactly; nothing applied
+#define LINK_ERR_REFUSED 4 // the screen refused a record, e.g. text for a chart; the others were applied
+#define LINK_ERR_BUSY 5    // an image cannot start while the panel refreshes; nothing applied, send again
+
+struct LinkStats {
+    unsigned long frames;     // frames received whole, whatever their CRC
+    unsigned long naks;
+    unsigned long duplicates; // repeated frames acknowledged again
+    unsigned long syncs;      // LINK_SYNC frames
+    unsigned long records;    // records applied
+    unsigned long draws;      // draws started for LINK_DRAW
+};
+
+class ScreenLink {
+    public:
+        ScreenLink(Screen *screen);
+        size_t Receive(uint8_t byte, uint8_t *reply);
+        bool Poll();
+        const LinkStats *GetStats();
+
+    private:
+        Screen *screen;
+        uint8_t body[LINK_MAX_BODY + 1]; // room to terminate a text at the very end
+        uint8_t state = 0;
+        uint8_t seq = 0;
+        uint8_t length = 0;
+        uint8_t at = 0;
+        uint16_t crc = 0;
+        int lastSeq = -1; // seq of the last frame applied
+        bool drawPending = false;
+        LinkStats stats = { 0, 0, 0, 0, 0, 0 };
+        int Check();
+        int Apply(uint8_t op, uint8_t *args, uint8_t n);
+};
+
+uint16_t link_crc(uint16_t crc, uint8_t byte);
+
+#endif
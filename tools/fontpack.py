@@ -0,0 +1,94 @@
+#!/usr/bin/env python3
+"""
+Offline font compiler: converts the byte-padded sFONT tables (font8.c .. font24.c)
+into the packed format, where each glyph is Height rows of exactly Width bits laid
+out back to back and rounded up to a whole byte per glyph. Glyph rows are decoded
+one at a time by glyph_row() in screen.cpp, so no glyph is ever expanded in RAM.
+
+usage: tools/fontpack.py font8.c [font12.c ...]
+writes font8p.c etc. next to the inputs and prints the flash saved per font
+"""
+import os
+import re
+import sys
+
+GLYPH = re.compile(r"//\s*@(\d+)\s+'(.*)'\s+\((\d+) pixels wide\)")
+HEX = re.compile(r"0x([0-9A-Fa-f]{2})")
+FONT = re.compile(r"sFONT\s+(\w+)\s*=\s*\{\s*(\w+)\s*,\s*(\d+)\s*,[^\d]*(\d+)", re.S)
+
+
+def parse(path):
+    """returns (name, width, height, [(label, [row bits, ...]), ...])"""
+    text = open(path).read()
+    name, _, width, height = FONT.search(text).groups()
+    width, height = int(width), int(height)
+    rowbytes = (width + 7) // 8
+    glyphs = []
+    for line in text[:text.index("};")].splitlines():
+        m = GLYPH.search(line)
+        if m:
+            glyphs.append((m.group(2), []))
+            continue
+        data = HEX.findall(line.split("//")[0])
+        if data and glyphs:
+            value = 0
+            for byte in data:
+                value = (value << 8) | int(byte, 16)
+            glyphs[-1][1].append(value >> (8 * rowbytes - width))
+    for label, rows in glyphs:
+        if len(rows) != height:
+            raise ValueError("%s: glyph '%s' has %d rows, expected %d" % (path, label, len(rows), height))
+    return name, width, height, glyphs
+
+
+def pack(width, rows):
+    bits = 0
+    for row in rows:
+        bits = (bits << width) | row
+    total = width * len(rows)
+    pad = (8 - total % 8) % 8
+    bits <<= pad
+    return list(((bits >> (8 * i)) & 0xFF) for i in reversed(range((total + pad) // 8)))
+
+
+def emit(src, name, width, height, glyphs):
+    packed_name = name + "P"
+    glyph_bytes = (width * height + 7) // 8
+    out = []
+    out.append("/* Packed %s generated by tools/fontpack.py from %s, do not edit." % (name, os.path.basename(src)))
+    out.append("   %d x %d glyphs, %d bytes per glyph. */" % (width, height, glyph_bytes))
+    out.append("")
+    out.append('#include "fonts.h"')
+    out.append("")
+    out.append("const uint8_t %s_Table[] PROGMEM = " % packed_name)
+    out.append("{")
+    for index, (label, rows) in enumerate(glyphs):
+        out.append("\t// @%d '%s'" % (index * glyph_bytes, label))
+        out.append("\t" + " ".join("0x%02X," % b for b in pack(width, rows)))
+    out.append("};")
+    out.append("")
+    out.append("sFONT %s = {" % packed_name)
+    out.append("  %s_Table," % packed_name)
+    out.append("  %d, /* Width */" % width)
+    out.append("  %d, /* Height */" % height)
+    out.append("  FONT_FORMAT_PACKED,")
+    out.append("};")
+    out.append("")
+    dst = os.path.join(os.path.dirname(src), os.path.basename(src).replace(".c", "p.c"))
+    with open(dst, "w") as f:
+        f.write("\n".join(out))
+    return dst, glyph_bytes * len(glyphs)
+
+
+def main(paths):
+    for src in paths:
+        name, width, height, glyphs = parse(src)
+        before = height * ((width + 7) // 8) * len(glyphs)
+        dst, after = emit(src, name, width, height, glyphs)
+        print("%-8s %5d -> %5d bytes (%4.1f%% saved) %s" % (name, before, after, 100.0 * (before - after) / before, dst))
+
+
+if __name__ == "__main__":
+    if len(sys.argv) < 2:
+        sys.exit(__doc__)
+    main(sys.argv[1:])
@@ -0,0 +1,206 @@
+#!/usr/bin/env python3
+"""
+Offline font compiler for proportional fonts (FONT_FORMAT_PROP). Each glyph gets its
+own advance: Height rows of exactly that many bits, laid out back to back and rounded
+up to a whole byte per glyph, found through a PROGMEM offset table. sFONT.Width holds
+the mean advance, so EPD_WIDTH / Width cells per line hold typical text; lines of many
+narrow characters run out of cells before pixels.
+
+Two sources are understood:
+  font8.c ..    the fixed-width sFONT tables; blank columns either side of each glyph
+                are trimmed and one column of spacing is kept on the right
+  name.bdf      X11 BDF fonts, characters 32..126 placed on the baseline using
+                FONT_ASCENT / FONT_DESCENT and advanced by DWIDTH. With --codes the
+                listed code points the BDF has are kept instead, and a sorted code
+                point table is emitted for Screen's UTF-8 lookup (BMP only)
+
+usage: tools/fontprop.py [--name FontName] [--codes 32-126,0xB0,0x2190-0x21FF] font8.c [name.bdf ...]
+writes font8v.c (Font8V) etc. next to the inputs and prints advances and flash used
+"""
+import os
+import re
+import sys
+
+from fontpack import parse, pack
+
+FIRST, LAST = 32, 126
+MAX_ADVANCE = 24  # longest row blit_push takes in one call
+
+
+def trim(width, height, glyphs):
+    """fixed-width glyphs -> [(label, advance, [row bits, ...])] without the blank side columns"""
+    out = []
+    for label, rows in glyphs:
+        ink = 0
+        for row in rows:
+            ink |= row
+        if ink == 0:
+            out.append((label, (width + 1) // 2, [0] * height))
+            continue
+        left = width - ink.bit_length()   # first inked column from the left
+        right = width - 1
+        while not (ink >> (width - 1 - right)) & 1:
+            right -= 1
+        ink_width = right - left + 1
+        advance = ink_width + 1
+        rows = [((row >> (width - 1 - right)) & ((1 << ink_width) - 1)) << 1 for row in rows]
+        out.append((label, advance, rows))
+    return out
+
+
+def parse_codes(spec):
+    """'32-126,0xB0' -> sorted list of code points"""
+    codes = set()
+    for part in spec.split(","):
+        first, _, last = part.partition("-")
+        codes.update(range(int(first, 0), int(last or first, 0) + 1))
+    if max(codes) > 0xFFFF:
+        raise ValueError("code points above U+FFFF are not supported")
+    return sorted(codes)
+
+
+def parse_bdf(path, codes=None):
+    """returns (height, [(label, advance, [row bits, ...]), ...]) for characters 32..126,
+    or for those of codes the font has"""
+    ascent = descent = None
+    glyphs = {}
+    lines = iter(open(path, encoding="latin-1").read().splitlines())
+    for line in lines:
+        words = line.split()
+        if not words:
+            continue
+        if words[0] == "FONT_ASCENT":
+            ascent = int(words[1])
+        elif words[0] == "FONT_DESCENT":
+            descent = int(words[1])
+        elif words[0] == "STARTCHAR":
+            code = advance = None
+            bbx = (0, 0, 0, 0)
+            bitmap = []
+            for line in lines:
+                words = line.split()
+                if words[0] == "ENCODING":
+                    code = int(words[1])
+                elif words[0] == "DWIDTH":
+                    advance = int(words[1])
+                elif words[0] == "BBX":
+                    bbx = tuple(int(w) for w in words[1:5])
+                elif words[0] == "BITMAP":
+                    for line in lines:
+                        if line.strip() == "ENDCHAR":
+                            break
+                        bitmap.append(int(line.strip(), 16) >> (len(line.strip()) * 4 - bbx[0]) if bbx[0] else 0)
+                    break
+            if code is not None and (FIRST <= code <= LAST or codes):
+                glyphs[code] = (advance if advance is not None else bbx[0] + bbx[2], bbx, bitmap)
+    if ascent is None or descent is None:
+        raise ValueError("%s: FONT_ASCENT and FONT_DESCENT are required" % path)
+    height = ascent + descent
+    default = glyphs.get(FIRST, (height // 2, (0, 0, 0, 0), []))[0]
+    out = []
+    for code in (c for c in codes if c in glyphs) if codes else range(FIRST, LAST + 1):
+        advance, (w, h, x, y), bitmap = glyphs.get(code, (default, (0, 0, 0, 0), []))
+        rows = [0] * height
+        for j, bits in enumerate(bitmap):
+            top = ascent - (y + h) + j
+            if not 0 <= top < height:
+                continue
+            for col in range(w):
+                px = x + col
+                if (bits >> (w - 1 - col)) & 1 and 0 <= px < advance:
+                    rows[top] |= 1 << (advance - 1 - px)
+        out.append((chr(code) if code < 0x7F else "U+%04X" % code, advance, rows, code))
+    return height, out
+
+
+def emit(src, dst, name, height, glyphs, mapped=False):
+    for label, advance, _, _ in glyphs:
+        if not 1 <= advance <= MAX_ADVANCE:
+            raise ValueError("%s: glyph '%s' advances %d, expected 1..%d" % (src, label, advance, MAX_ADVANCE))
+    advances = [advance for _, advance, _, _ in glyphs]
+    mean = sum(advances[1:]) / float(len(advances) - 1)  # over the printable characters after space
+    offsets = []
+    table = 0
+    out = []
+    out.append("/* Proportional %s generated by tools/fontprop.py from %s, do not edit." % (name, os.path.basename(src)))
+    out.append("   %d rows, advances %d..%d pixels. */" % (height, min(advances), max(advances)))
+    out.append("")
+    out.append('#include "fonts.h"')
+    out.append("")
+    out.append("const uint8_t %s_Table[] PROGMEM = " % name)
+    out.append("{")
+    for label, advance, rows, _ in glyphs:
+        data = pack(advance, rows)
+        offsets.append(table)
+        out.append("\t// @%d '%s' (%d pixels wide)" % (table, label, advance))
+        out.append("\t" + " ".join("0x%02X," % b for b in data))
+        table += len(data)
+    out.append("};")
+    out.append("")
+    out.append("const uint8_t %s_Widths[] PROGMEM = " % name)
+    out.append("{")
+    for i in range(0, len(advances), 16):
+        out.append("\t" + " ".join("%d," % a for a in advances[i:i + 16]))
+    out.append("};")
+    out.append("")
+    out.append("const uint16_t %s_Offsets[] PROGMEM = " % name)
+    out.append("{")
+    for i in range(0, len(offsets), 12):
+        out.append("\t" + " ".join("%d," % o for o in offsets[i:i + 12]))
+    out.append("};")
+    out.append("")
+    if mapped:
+        out.append("const uint16_t %s_Codes[] PROGMEM = " % name)
+        out.append("{")
+        for i in range(0, len(glyphs), 10):
+            out.append("\t" + " ".join("0x%04X," % g[3] for g in glyphs[i:i + 10]))
+        out.append("};")
+        out.append("")
+    out.append("sFONT %s = {" % name)
+    out.append("  %s_Table," % name)
+    out.append("  %d, /* Width: mean advance */" % int(mean))
+    out.append("  %d, /* Height */" % height)
+    out.append("  FONT_FORMAT_PROP,")
+    out.append("  %s_Widths," % name)
+    out.append("  %s_Offsets," % name)
+    if mapped:
+        out.append("  %s_Codes," % name)
+        out.append("  %d, /* Count */" % len(glyphs))
+    out.append("};")
+    out.append("")
+    with open(dst, "w") as f:
+        f.write("\n".join(out))
+    return table + len(advances) + (4 if mapped else 2) * len(offsets), advances, mean
+
+
+def main(args):
+    name = codes = None
+    while len(args) > 1 and args[0] in ("--name", "--codes"):
+        if args[0] == "--name":
+            name = args[1]
+        else:
+            codes = parse_codes(args[1])
+        args = args[2:]
+    for src in args:
+        base = os.path.splitext(src)[0]
+        if src.endswith(".bdf"):
+            height, glyphs = parse_bdf(src, codes)
+            font = name or "Font" + re.sub(r"\W", "", os.path.basename(base))
+            before = None
+        else:
+            fixed, width, height, cells = parse(src)
+            glyphs = [g + (FIRST + i,) for i, g in enumerate(trim(width, height, cells))]
+            font = name or fixed + "V"
+            before = width
+        dst = base + "v.c"
+        size, advances, mean = emit(src, dst, font, height, glyphs, codes is not None and src.endswith(".bdf"))
+        line = "%-8s %5d bytes, advance %d..%d mean %.1f" % (font, size, min(advances), max(advances), mean)
+        if before:
+            line += " (fixed %d, %+.0f%% characters per line)" % (before, 100.0 * (before / mean - 1))
+        print("%s %s" % (line, dst))
+
+
+if __name__ == "__main__":
+    if len(sys.argv) < 2:
+        sys.exit(__doc__)
+    main(sys.argv[1:])
@@ -0,0 +1,184 @@
+#!/usr/bin/env python3
+"""
+Sending side of the ScreenLink protocol (screen_link.h). Commands are packed into as few
+frames as fit LINK_MAX_BODY and sent one frame at a time, each waiting for its ACK; a
+frame is sent again after a NAK or a timeout, and for a few seconds while the board
+answers that the panel is busy refreshing. The first frame is a sync, so the board
+does not take the frame after it for a repeat of an earlier sender's last one. Commands given together are drawn by one
+refresh when the list ends with draw.
+
+  print SECTION TEXT [left|center|right]   replace a section's text
+  append SECTION TEXT                      add a line to a log section
+  shape SECTION add|INDEX KIND X0 Y0 X1 Y1 [VALUE]
+                                           KIND: hline vline line rect fill bar
+  samples SECTION V [V ...]                add values to a chart
+  image SECTION FILE.pbm                   send a 122 pixel wide P4 picture
+  draw | clear | sleep | wake
+
+usage: tools/screenlink.py [--port /dev/ttyACM0] [--baud 115200] [--out frames.bin] "COMMAND" ...
+each COMMAND is one argument, e.g. "print 0 'Hello world' center"; with --out the frames
+are written to a file ("-" for stdout) instead of a port
+"""
+import os
+import shlex
+import sys
+import termios
+import time
+
+SOF, ACK, NAK = 0x7E, 0x06, 0x15
+MAX_BODY = 58  # a whole frame fits the 63 bytes an Arduino's serial receive buffer holds
+PRINT, APPEND, SHAPE, SAMPLES, IMAGE, PIXELS, IMAGE_END, DRAW, CLEAR, SLEEP, WAKE, SYNC = range(1, 13)
+ALIGN = {"left": 0, "center": 1, "right": 2}
+KINDS = {"hline": 0, "vline": 1, "line": 2, "rect": 3, "fill": 4, "bar": 5}
+IMAGE_PBM = 1
+ERRORS = {1: "bad CRC", 2: "too long", 3: "bad record", 4: "refused", 5: "busy"}
+
+
+def crc16(data, crc=0xFFFF):
+    """CRC-16/CCITT-FALSE"""
+    for byte in data:
+        crc ^= byte << 8
+        for _ in range(8):
+            crc = (crc << 1) ^ 0x1021 if crc & 0x8000 else crc << 1
+        crc &= 0xFFFF
+    return crc
+
+
+def frame(seq, body):
+    head = bytes([seq & 0xFF, len(body)]) + body
+    crc = crc16(head)
+    return bytes([SOF]) + head + bytes([crc & 0xFF, crc >> 8])
+
+
+def record(op, args=b""):
+    if len(args) + 2 > MAX_BODY:
+        raise ValueError("record of %d bytes does not fit a frame" % len(args))
+    return bytes([op, len(args)]) + args
+
+
+def records(command):
+    """the records for one command line"""
+    words = shlex.split(command)
+    op, args = words[0], words[1:]
+    if op == "print":
+        align = ALIGN[args[2]] if len(args) > 2 else 0
+        return [record(PRINT, bytes([int(args[0]), align]) + args[1].encode())]
+    if op == "append":
+        return [record(APPEND, bytes([int(args[0])]) + args[1].encode())]
+    if op == "shape":
+        index = 0xFF if args[1] == "add" else int(args[1])
+        value = int(args[7]) if len(args) > 7 else 0
+        return [record(SHAPE, bytes([int(args[0]), index, KINDS[args[2]]] + [int(a) for a in args[3:7]] + [value]))]
+    if op == "samples":
+        out, values = [], [int(v) for v in args[1:]]
+        per = (MAX_BODY - 3) // 2
+        for i in range(0, len(values), per):
+            data = b"".join((v & 0xFFFF).to_bytes(2, "little") for v in values[i:i + per])
+            out.append(record(SAMPLES, bytes([int(args[0])]) + data))
+        return out
+    if op == "image":
+        data = open(args[1], "rb").read()
+        out = [record(IMAGE, bytes([int(args[0]), IMAGE_PBM]))]
+        for i in range(0, len(data), MAX_BODY - 2):
+            out.append(record(PIXELS, data[i:i + MAX_BODY - 2]))
+        return out + [record(IMAGE_END)]
+    simple = {"draw": DRAW, "clear": CLEAR, "sleep": SLEEP, "wake": WAKE}
+    return [record(simple[op])]
+
+
+def frames(commands, seq=1):
+    """a sync, then the records of all commands packed into frames in order"""
+    body, out = b"", [frame(seq - 1, record(SYNC))]
+    for command in commands:
+        for rec in records(command):
+            if len(body) + len(rec) > MAX_BODY:
+                out.append(frame(seq, body))
+                seq, body = seq + 1, b""
+            body += rec
+    if body:
+        out.append(frame(seq, body))
+    return out
+
+
+def open_port(path, baud):
+    fd = os.open(path, os.O_RDWR | os.O_NOCTTY)
+    attrs = termios.tcgetattr(fd)
+    speed = getattr(termios, "B%d" % baud)
+    attrs[0] = 0                                     # iflag: raw
+    attrs[1] = 0                                     # oflag
+    attrs[2] = termios.CS8 | termios.CREAD | termios.CLOCAL
+    attrs[3] = 0                                     # lflag: no echo, not canonical
+    attrs[4] = attrs[5] = speed
+    attrs[6][termios.VMIN] = 0
+    attrs[6][termios.VTIME] = 1                      # reads give up after 0.1 s
+    termios.tcsetattr(fd, termios.TCSANOW, attrs)
+    return fd
+
+
+def answer(fd, seq, timeout):
+    """wait for the answer to seq: None on ACK, the NAK reason, or "timeout" """
+    end, got = time.time() + timeout, b""
+    while time.time() < end:
+        got += os.read(fd, 16)
+        while len(got) >= 2:
+            if got[0] == ACK and got[1] == seq & 0xFF:
+                return None
+            if got[0] == NAK:
+                if len(got) < 3:
+                    break
+                return ERRORS.get(got[2], "error %d" % got[2])
+            got = got[1:]  # other output, or the answer to an older frame
+    return "timeout"
+
+
+def send(fd, out, tries=8, timeout=1.0, busy=5.0):
+    """tries counts timeouts and bad frames; a busy panel is asked again for up to busy seconds"""
+    sent, start = 0, time.time()
+    for f in out:
+        failed, until = 0, time.time() + busy
+        while True:
+            os.write(fd, f)
+            reason = answer(fd, f[1], timeout)
+            if reason is None:
+                break
+            if reason == "refused":
+                print("frame %d: a record was refused" % f[1], file=sys.stderr)
+                break
+            if reason == "busy":
+                if time.time() > until:
+                    sys.exit("frame %d: the panel was still busy after %.0f s" % (f[1], busy))
+                time.sleep(0.1)
+                continue
+            failed += 1
+            if failed == tries:
+                sys.exit("frame %d: no answer after %d tries (%s)" % (f[1], tries, reason))
+        sent += len(f)
+    secs = time.time() - start
+    print("%d frames, %d bytes in %.2f s" % (len(out), sent, secs))
+
+
+def main(args):
+    port, baud, dst = "/dev/ttyACM0", 115200, None
+    while len(args) > 1 and args[0] in ("--port", "--baud", "--out"):
+        if args[0] == "--port":
+            port = args[1]
+        elif args[0] == "--baud":
+            baud = int(args[1])
+        else:
+            dst = args[1]
+        args = args[2:]
+    out = frames(args)
+    if dst is not None:
+        data = b"".join(out)
+        if dst == "-":
+            sys.stdout.buffer.write(data)
+        else:
+            open(dst, "wb").write(data)
+        return
+    send(open_port(port, baud), out)
+
+
+if __name__ == "__main__":
+    if len(sys.argv) < 2:
+        sys.exit(__doc__)
+    main(sys.argv[1:])